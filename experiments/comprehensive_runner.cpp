@@ -2,7 +2,10 @@
 #include "../src/algorithms/kruskal.hpp"
 #include "../src/algorithms/prim.hpp"
 #include "../src/algorithms/kkt.hpp"
+#include "../src/algorithms/kkt_parallel.hpp"
 #include "../src/algorithms/boruvka_parallel.hpp"
+#include "../src/algorithms/filter_kruskal.hpp"
+#include "../src/algorithms/verifier.hpp"
 #include "../src/generators/graph_generator.hpp"
 #include <iostream>
 #include <fstream>
@@ -14,34 +17,34 @@
 
 struct ComprehensiveExperiment {
     std::string name;
+    GraphFamily family;
     int vertices;
     double density;
     int edges;
     std::vector<MSTResult> results;
+    std::vector<VerificationReport> checks;
     std::string status;
 };
 
+// Peak bytes while generating and solving: the generator's edge batch plus the
+// Graph's two adjacency entries, edge lists and id map node per edge. Both
+// generators now use memory proportional to their output, so this is all.
 size_t estimateMemoryUsage(int V, double density) {
     size_t maxEdges = static_cast<size_t>(V) * (V - 1) / 2;
-    size_t edges = static_cast<size_t>(maxEdges * density);
+    size_t edges = density < 1.0 ? static_cast<size_t>(maxEdges * density)
+                                 : static_cast<size_t>(V * density / 2);
     if (edges > maxEdges) edges = maxEdges;
-    size_t adjacencyMemory = V * sizeof(std::vector<std::pair<int, double>>) + 
-                           edges * sizeof(std::pair<int, double>);
-    size_t edgeListMemory = edges * sizeof(std::tuple<int, int, double>);
-    return adjacencyMemory + edgeListMemory + (100 * 1024 * 1024); 
+    size_t perEdge = sizeof(BuilderEdge) + 2 * sizeof(std::pair<int, double>) +
+                     sizeof(std::tuple<int, int, double>) + sizeof(std::tuple<int, int, double, int>) +
+                     2 * sizeof(void*) + sizeof(std::pair<const int, std::tuple<int, int, double>>);
+    size_t adjacencyMemory = V * sizeof(std::vector<std::pair<int, double>>);
+    return adjacencyMemory + edges * perEdge + (100 * 1024 * 1024); 
 }
 
 bool shouldSkipDueToMemory(int V, double density) {
     size_t estimatedMemory = estimateMemoryUsage(V, density);
     size_t safeLimit = 800 * 1024 * 1024; 
-    if (estimatedMemory > safeLimit) {
-        return true;
-    }
-    
-    if (V >= 100000 && density > 1.0) return true;
-    if (V >= 50000 && density > 5.0) return true;
-    if (V >= 20000 && density > 10.0) return true;
-    return false;
+    return estimatedMemory > safeLimit;
 }
 
 void runComprehensiveExperiments() {
@@ -53,10 +56,14 @@ void runComprehensiveExperiments() {
     std::vector<std::unique_ptr<MSTAlgorithm>> algorithms;
     
     algorithms.push_back(std::make_unique<Kruskal>());
+    algorithms.push_back(std::make_unique<FilterKruskal>());
     algorithms.push_back(std::make_unique<Prim>());
+    algorithms.push_back(std::make_unique<Prim>(PrimHeap::Indexed));
     algorithms.push_back(std::make_unique<KKT>());
+    algorithms.push_back(std::make_unique<KKTParallel>(4));
     algorithms.push_back(std::make_unique<BoruvkaParallel>(2));   
     algorithms.push_back(std::make_unique<BoruvkaParallel>(4)); 
+    algorithms.push_back(std::make_unique<BoruvkaParallel>(4, BoruvkaMode::Contract));
     std::vector<ComprehensiveExperiment> experiments;
     
     std::vector<int> sizes = {
@@ -72,115 +79,129 @@ void runComprehensiveExperiments() {
         1.0, 2.0, 5.0,          
         10.0, 20.0             
     };
+
+    // The skewed and spatial families are swept by average degree only.
+    std::vector<std::pair<GraphFamily, std::vector<double>>> sweeps = {
+        {GraphFamily::Uniform, densities},
+        {GraphFamily::RMAT, {5.0, 20.0}},
+        {GraphFamily::PowerLaw, {5.0, 20.0}},
+        {GraphFamily::Geometric, {5.0, 20.0}},
+        {GraphFamily::KNN, {5.0, 20.0}}
+    };
     
-    int totalExperiments = sizes.size() * densities.size();
+    int totalExperiments = 0;
+    for (const auto& sweep : sweeps) totalExperiments += sizes.size() * sweep.second.size();
     int currentExperiment = 0;
     int graphsTested = 0;
     int graphsSkipped = 0;
     std::cout << "Total possible graphs: " << totalExperiments << std::endl;
-    for (int size : sizes) {
-        for (double density : densities) {
-            currentExperiment++;
-            ComprehensiveExperiment exp;
-            exp.name = "V" + std::to_string(size) + "_D" + std::to_string(density);
-            exp.vertices = size;
-            exp.density = density;
-            std::cout << "\n[" << currentExperiment << "] Testing " << exp.name;
-            if (shouldSkipDueToMemory(size, density)) {
-                std::cout << " - SKIPPED (memory constraints)" << std::endl;
-                exp.status = "SKIPPED_MEMORY";
-                experiments.push_back(exp);
-                graphsSkipped++;
-                continue;
-            }
+    for (const auto& [family, familyDensities] : sweeps) {
+        for (int size : sizes) {
+            for (double density : familyDensities) {
+                currentExperiment++;
+                ComprehensiveExperiment exp;
+                exp.name = "V" + std::to_string(size) + "_D" + std::to_string(density);
+                if (family != GraphFamily::Uniform) exp.name = GraphGenerator::familyName(family) + "_" + exp.name;
+                exp.family = family;
+                exp.vertices = size;
+                exp.density = density;
+                std::cout << "\n[" << currentExperiment << "] Testing " << exp.name;
+                if (shouldSkipDueToMemory(size, density)) {
+                    std::cout << " - SKIPPED (memory constraints)" << std::endl;
+                    exp.status = "SKIPPED_MEMORY";
+                    experiments.push_back(exp);
+                    graphsSkipped++;
+                    continue;
+                }
             
-            std::cout << std::endl;
-            auto startGen = std::chrono::high_resolution_clock::now();
-            try {
-                Graph graph = (density < 1.0) 
-                    ? generator.generateDenseGraph(size, density)
-                    : generator.generateSparseGraph(size, density);
+                std::cout << std::endl;
+                auto startGen = std::chrono::high_resolution_clock::now();
+                try {
+                    Graph graph = generator.generate(family, size, density);
                 
-                auto endGen = std::chrono::high_resolution_clock::now();
-                double genTime = std::chrono::duration<double, std::milli>(endGen - startGen).count();
-                exp.edges = graph.getEdges();
-                std::cout << "   Graph: " << graph.getVertices() << " vertices, " 
-                          << graph.getEdges() << " edges (generated in " 
-                          << std::fixed << std::setprecision(2) << genTime << " ms)" << std::endl;
-
-                if (!graph.isConnected()) {
-                    std::cout << "   Graph is not connected, adding edges." << std::endl;
-                    for (int i = 1; i < size; i++) {
-                        graph.addEdge(i-1, i, 1.0 + (i * 0.1));
-                    }
-                }
+                    auto endGen = std::chrono::high_resolution_clock::now();
+                    double genTime = std::chrono::duration<double, std::milli>(endGen - startGen).count();
+                    exp.edges = graph.getEdges();
+                    std::cout << "   Graph: " << graph.getVertices() << " vertices, " 
+                              << graph.getEdges() << " edges (generated in " 
+                              << std::fixed << std::setprecision(2) << genTime << " ms)" << std::endl;
                 
-                bool allSuccessful = true;
-                for (auto& algo : algorithms) {
-                    std::cout << "   Running " << std::setw(25) << std::left << algo->getName() << "...";
-                    std::cout.flush();
-                    try {
-                        auto algoStart = std::chrono::high_resolution_clock::now();
-                        MSTResult result = algo->solve(graph);
-                        auto algoEnd = std::chrono::high_resolution_clock::now();
-                        double measuredTime = std::chrono::duration<double, std::milli>(algoEnd - algoStart).count();
-                        result.executionTime = measuredTime; 
-                        exp.results.push_back(result);
-                        std::cout << " Time: " << std::setw(8) << std::fixed << std::setprecision(2) 
-                                  << result.executionTime << " ms";
+                    bool allSuccessful = true;
+                    for (auto& algo : algorithms) {
+                        std::cout << "   Running " << std::setw(25) << std::left << algo->getName() << "...";
+                        std::cout.flush();
+                        try {
+                            auto algoStart = std::chrono::high_resolution_clock::now();
+                            MSTResult result = algo->solve(graph);
+                            auto algoEnd = std::chrono::high_resolution_clock::now();
+                            double measuredTime = std::chrono::duration<double, std::milli>(algoEnd - algoStart).count();
+                            result.executionTime = measuredTime; 
+                            VerificationReport check = MSTVerifier::verify(graph, result);
+                            exp.results.push_back(result);
+                            exp.checks.push_back(check);
+                            std::cout << " Time: " << std::setw(8) << std::fixed << std::setprecision(2) 
+                                      << result.executionTime << " ms"
+                                      << " (verified in " << check.milliseconds << " ms)";
                         
-                        if (result.totalWeight < 0) {
-                            std::cout << " [INVALID_WEIGHT]";
+                            if (!check.valid()) {
+                                std::cout << " [INVALID: " << check.message << "]";
+                                allSuccessful = false;
+                            }
+                            std::cout << std::endl;
+                        
+                        } catch (const std::bad_alloc& e) {
+                            std::cout << " MEMORY_ERROR" << std::endl;
+                            MSTResult errorResult;
+                            errorResult.algorithmName = algo->getName() + "_MEMORY_ERROR";
+                            errorResult.executionTime = -1;
+                            errorResult.totalWeight = -1;
+                            errorResult.memoryUsage = -1;
+                            exp.results.push_back(errorResult);
+                            exp.checks.emplace_back();
+                            allSuccessful = false;
+                        } catch (const std::exception& e) {
+                            std::cout << " ERROR: " << e.what() << std::endl;
+                            MSTResult errorResult;
+                            errorResult.algorithmName = algo->getName() + "_ERROR";
+                            errorResult.executionTime = -1;
+                            errorResult.totalWeight = -1;
+                            errorResult.memoryUsage = -1;
+                            exp.results.push_back(errorResult);
+                            exp.checks.emplace_back();
                             allSuccessful = false;
                         }
-                        std::cout << std::endl;
-                        
-                    } catch (const std::bad_alloc& e) {
-                        std::cout << " MEMORY_ERROR" << std::endl;
-                        MSTResult errorResult;
-                        errorResult.algorithmName = algo->getName() + "_MEMORY_ERROR";
-                        errorResult.executionTime = -1;
-                        errorResult.totalWeight = -1;
-                        errorResult.memoryUsage = -1;
-                        exp.results.push_back(errorResult);
-                        allSuccessful = false;
-                    } catch (const std::exception& e) {
-                        std::cout << " ERROR: " << e.what() << std::endl;
-                        MSTResult errorResult;
-                        errorResult.algorithmName = algo->getName() + "_ERROR";
-                        errorResult.executionTime = -1;
-                        errorResult.totalWeight = -1;
-                        errorResult.memoryUsage = -1;
-                        exp.results.push_back(errorResult);
-                        allSuccessful = false;
                     }
-                }
-                exp.status = allSuccessful ? "COMPLETED" : "PARTIAL_ERROR";
-                experiments.push_back(exp);
-                graphsTested++;
+                    exp.status = allSuccessful ? "COMPLETED" : "PARTIAL_ERROR";
+                    experiments.push_back(exp);
+                    graphsTested++;
                 
-            } catch (const std::bad_alloc& e) {
-                std::cout << "   MEMORY ERROR generating graph: " << e.what() << std::endl;
-                exp.status = "GENERATION_MEMORY_ERROR";
-                experiments.push_back(exp);
-                graphsSkipped++;
-            } catch (const std::exception& e) {
-                std::cout << "   ERROR generating graph: " << e.what() << std::endl;
-                exp.status = "GENERATION_ERROR";
-                experiments.push_back(exp);
-                graphsSkipped++;
+                } catch (const std::bad_alloc& e) {
+                    std::cout << "   MEMORY ERROR generating graph: " << e.what() << std::endl;
+                    exp.status = "GENERATION_MEMORY_ERROR";
+                    experiments.push_back(exp);
+                    graphsSkipped++;
+                } catch (const std::exception& e) {
+                    std::cout << "   ERROR generating graph: " << e.what() << std::endl;
+                    exp.status = "GENERATION_ERROR";
+                    experiments.push_back(exp);
+                    graphsSkipped++;
+                }
             }
         }
     }
     
     std::ofstream csvFile("comprehensive_results.csv");
-    csvFile << "Experiment,Vertices,Edges,Density,Status,Algorithm,Time(ms),Memory(KB),Weight\n";
+    csvFile << "Experiment,Vertices,Edges,Density,Status,Algorithm,Time(ms),Memory(KB),Weight,Verified,VerifyTime(ms),Family\n";
     
     for (const auto& exp : experiments) {
-        for (const auto& result : exp.results) {
+        for (size_t i = 0; i < exp.results.size(); ++i) {
+            const auto& result = exp.results[i];
+            const auto& check = exp.checks[i];
             csvFile << exp.name << "," << exp.vertices << "," << exp.edges << "," << exp.density << ","
                    << exp.status << "," << result.algorithmName << "," << result.executionTime << ","
-                   << result.memoryUsage << "," << result.totalWeight << "\n";
+                   << result.memoryUsage << "," << result.totalWeight << ","
+                   << check.valid() << "," << check.milliseconds << ","
+                   << GraphGenerator::familyName(exp.family) << "\n";
         }
     }
     
@@ -2,7 +2,9 @@
 #include "../src/algorithms/kruskal.hpp"
 #include "../src/algorithms/prim.hpp"
 #include "../src/algorithms/kkt.hpp"
+#include "../src/algorithms/kkt_parallel.hpp"
 #include "../src/algorithms/boruvka_parallel.hpp"
+#include "../src/algorithms/verifier.hpp"
 #include "../src/generators/graph_generator.hpp"
 #include <iostream>
 #include <fstream>
@@ -19,6 +21,7 @@ void runFocusedKKTExperiments() {
     algorithms.push_back(std::make_unique<Kruskal>());
     algorithms.push_back(std::make_unique<Prim>());
     algorithms.push_back(std::make_unique<KKT>());
+    algorithms.push_back(std::make_unique<KKTParallel>(4));
     algorithms.push_back(std::make_unique<BoruvkaParallel>(2));
     algorithms.push_back(std::make_unique<BoruvkaParallel>(4));
     
@@ -26,7 +29,7 @@ void runFocusedKKTExperiments() {
     std::vector<double> densities = {0.01, 0.1, 1.0, 5.0};
     
     std::ofstream csvFile("focused_kkt_results.csv");
-    csvFile << "Experiment,Vertices,Edges,Density,Algorithm,Time(ms),Memory(KB),Weight\n";
+    csvFile << "Experiment,Vertices,Edges,Density,Algorithm,Time(ms),Memory(KB),Weight,BaseCaseTime(ms),BaseCases,Verified,VerifyTime(ms)\n";
     
     int total = sizes.size() * densities.size();
     int current = 0;
@@ -51,14 +54,30 @@ void runFocusedKKTExperiments() {
                 
                 try {
                     MSTResult result = algo->solve(graph);
+                    VerificationReport check = MSTVerifier::verify(graph, result);
+                    bool hasBaseCase = result.metrics.count("base_case_ms") > 0;
                     std::cout << " Time: " << std::setw(8) << std::fixed 
                               << std::setprecision(2) << result.executionTime 
-                              << " ms" << std::endl;
+                              << " ms";
+                    if (hasBaseCase) {
+                        std::cout << " (base cases: " << result.metrics.at("base_case_ms") << " ms in "
+                                  << static_cast<size_t>(result.metrics.at("base_cases")) << ")";
+                    }
+                    if (!check.valid()) {
+                        std::cout << " [INVALID: " << check.message << "]";
+                    }
+                    std::cout << std::endl;
                     
                     csvFile << "V" << size << "_D" << density << "," 
                            << size << "," << graph.getEdges() << "," << density << ","
                            << result.algorithmName << "," << result.executionTime << ","
-                           << result.memoryUsage << "," << result.totalWeight << "\n";
+                           << result.memoryUsage << "," << result.totalWeight << ",";
+                    if (hasBaseCase) {
+                        csvFile << result.metrics.at("base_case_ms") << "," << result.metrics.at("base_cases");
+                    } else {
+                        csvFile << ",";
+                    }
+                    csvFile << "," << check.valid() << "," << check.milliseconds << "\n";
                     
                 } catch (const std::exception& e) {
                     std::cout << " ERROR: " << e.what() << std::endl;
@@ -1,8 +1,11 @@
 #include "../src/data_structures/graph.hpp"
+#include "../src/data_structures/csr_graph.hpp"
 #include "../src/algorithms/kruskal.hpp"
 #include "../src/algorithms/prim.hpp"
 #include "../src/algorithms/kkt.hpp"
+#include "../src/algorithms/kkt_parallel.hpp"
 #include "../src/algorithms/boruvka_parallel.hpp"
+#include "../src/algorithms/verifier.hpp"
 #include "../src/generators/graph_generator.hpp"
 #include <iostream>
 #include <fstream>
@@ -13,10 +16,16 @@
 
 struct LargeExperiment {
     std::string name;
+    GraphFamily family;
     int vertices;
     double density;
     int edges;
+    size_t graphMemory;
+    size_t csrMemory;
     std::vector<MSTResult> results;
+    std::vector<MSTResult> csrResults;
+    std::vector<VerificationReport> checks;
+    std::vector<VerificationReport> csrChecks;
 };
 
 void runLargeScaleExperiments() {
@@ -27,86 +36,136 @@ void runLargeScaleExperiments() {
     std::vector<std::unique_ptr<MSTAlgorithm>> algorithms;
     algorithms.push_back(std::make_unique<Kruskal>());
     algorithms.push_back(std::make_unique<Prim>());   
+    algorithms.push_back(std::make_unique<Prim>(PrimHeap::Indexed));
     algorithms.push_back(std::make_unique<KKT>());
+    algorithms.push_back(std::make_unique<KKTParallel>(4));
     algorithms.push_back(std::make_unique<BoruvkaParallel>(2));   
     algorithms.push_back(std::make_unique<BoruvkaParallel>(4)); 
+    algorithms.push_back(std::make_unique<BoruvkaParallel>(4, BoruvkaMode::Contract));
     std::vector<LargeExperiment> experiments;
     
     std::vector<int> sizes = {1000, 5000, 10000, 25000, 50000};
     std::vector<double> densities = {0.01, 0.1, 1.0, 5.0};
+    std::vector<std::pair<GraphFamily, std::vector<double>>> sweeps = {
+        {GraphFamily::Uniform, densities},
+        {GraphFamily::RMAT, {5.0}},
+        {GraphFamily::PowerLaw, {5.0}},
+        {GraphFamily::Geometric, {5.0}},
+        {GraphFamily::KNN, {5.0}}
+    };
     
-    int totalExperiments = sizes.size() * densities.size();
+    int totalExperiments = 0;
+    for (const auto& sweep : sweeps) totalExperiments += sizes.size() * sweep.second.size();
     int currentExperiment = 0;
-    for (int size : sizes) {
-        for (double density : densities) {
-            currentExperiment++;
-            LargeExperiment exp;
-            exp.name = "V" + std::to_string(size) + "_D" + std::to_string(density);
-            exp.vertices = size;
-            exp.density = density;
+    for (const auto& [family, familyDensities] : sweeps) {
+        for (int size : sizes) {
+            for (double density : familyDensities) {
+                currentExperiment++;
+                LargeExperiment exp;
+                exp.name = "V" + std::to_string(size) + "_D" + std::to_string(density);
+                if (family != GraphFamily::Uniform) exp.name = GraphGenerator::familyName(family) + "_" + exp.name;
+                exp.family = family;
+                exp.vertices = size;
+                exp.density = density;
             
-            std::cout << "\n [" << currentExperiment << "/" << totalExperiments 
-                      << "] Testing " << exp.name << std::endl;
+                std::cout << "\n [" << currentExperiment << "/" << totalExperiments 
+                          << "] Testing " << exp.name << std::endl;
             
-            if (size >= 50000 && density > 5.0) {
-                std::cout << "   Skipping (memory constraints)" << std::endl;
-                continue;
-            }
-            auto startGen = std::chrono::high_resolution_clock::now();
+                if (size >= 50000 && density > 5.0) {
+                    std::cout << "   Skipping (memory constraints)" << std::endl;
+                    continue;
+                }
+                auto startGen = std::chrono::high_resolution_clock::now();
             
-            try {
-                Graph graph = (density < 1.0) 
-                    ? generator.generateDenseGraph(size, density)
-                    : generator.generateSparseGraph(size, density);
+                try {
+                    Graph graph = generator.generate(family, size, density);
                 
-                auto endGen = std::chrono::high_resolution_clock::now();
-                double genTime = std::chrono::duration<double, std::milli>(endGen - startGen).count();
-                exp.edges = graph.getEdges();
-                std::cout << "   Graph: " << graph.getVertices() << " vertices, " 
-                          << graph.getEdges() << " edges (generated in " 
-                          << std::fixed << std::setprecision(2) << genTime << " ms)" << std::endl;
+                    auto endGen = std::chrono::high_resolution_clock::now();
+                    double genTime = std::chrono::duration<double, std::milli>(endGen - startGen).count();
+                    exp.edges = graph.getEdges();
+                    std::cout << "   Graph: " << graph.getVertices() << " vertices, " 
+                              << graph.getEdges() << " edges (generated in " 
+                              << std::fixed << std::setprecision(2) << genTime << " ms)" << std::endl;
                 
-                if (!graph.isConnected()) {
-                    for (int i = 1; i < size; i++) {
-                        graph.addEdge(i-1, i, 1.0);
-                    }
-                }
+                    auto startCSR = std::chrono::high_resolution_clock::now();
+                    CSRGraph csr(graph);
+                    auto endCSR = std::chrono::high_resolution_clock::now();
+                    double csrTime = std::chrono::duration<double, std::milli>(endCSR - startCSR).count();
+                    exp.graphMemory = graph.memoryBytes();
+                    exp.csrMemory = csr.memoryBytes();
+                    std::cout << "   Memory: Graph " << exp.graphMemory / 1024 << " KB, CSR "
+                              << exp.csrMemory / 1024 << " KB (" << std::setprecision(2)
+                              << static_cast<double>(exp.graphMemory) / exp.csrMemory << "x, built in "
+                              << csrTime << " ms)" << std::endl;
                 
-                for (auto& algo : algorithms) {
-                    std::cout << "   Running " << std::setw(25) << std::left << algo->getName() << "...";
-                    std::cout.flush();
+                    for (auto& algo : algorithms) {
+                        std::cout << "   Running " << std::setw(25) << std::left << algo->getName() << "...";
+                        std::cout.flush();
                     
-                    try {
-                        MSTResult result = algo->solve(graph);
-                        exp.results.push_back(result);
-                        std::cout << " Time: " << std::setw(8) << std::fixed << std::setprecision(2) 
-                                  << result.executionTime << " ms" << std::endl;
-                    } catch (const std::exception& e) {
-                        std::cout << " ERROR: " << e.what() << std::endl;
-                        MSTResult errorResult;
-                        errorResult.algorithmName = algo->getName() + "_ERROR";
-                        errorResult.executionTime = -1;
-                        errorResult.totalWeight = -1;
-                        exp.results.push_back(errorResult);
+                        try {
+                            MSTResult result = algo->solve(graph);
+                            MSTResult csrResult = algo->solve(csr);
+                            VerificationReport check = MSTVerifier::verify(csr, result);
+                            VerificationReport csrCheck = MSTVerifier::verify(csr, csrResult);
+                            exp.results.push_back(result);
+                            exp.csrResults.push_back(csrResult);
+                            exp.checks.push_back(check);
+                            exp.csrChecks.push_back(csrCheck);
+                            std::cout << " Time: " << std::setw(8) << std::fixed << std::setprecision(2) 
+                                      << result.executionTime << " ms, CSR: " << std::setw(8)
+                                      << csrResult.executionTime << " ms, verify: "
+                                      << check.milliseconds << " ms";
+                            if (!check.valid() || !csrCheck.valid()) {
+                                std::cout << " [INVALID: " << (check.valid() ? csrCheck.message : check.message) << "]";
+                            }
+                            std::cout << std::endl;
+                            if (!result.metrics.empty()) {
+                                std::cout << "      " << result.metricsSummary() << std::endl;
+                            }
+                        } catch (const std::exception& e) {
+                            std::cout << " ERROR: " << e.what() << std::endl;
+                            MSTResult errorResult;
+                            errorResult.algorithmName = algo->getName() + "_ERROR";
+                            errorResult.executionTime = -1;
+                            errorResult.totalWeight = -1;
+                            exp.results.push_back(errorResult);
+                            exp.csrResults.push_back(errorResult);
+                            exp.checks.emplace_back();
+                            exp.csrChecks.emplace_back();
+                        }
                     }
-                }
                 
-                experiments.push_back(exp);
+                    experiments.push_back(exp);
                 
-            } catch (const std::exception& e) {
-                std::cout << "   ERROR: " << e.what() << std::endl;
+                } catch (const std::exception& e) {
+                    std::cout << "   ERROR: " << e.what() << std::endl;
+                }
             }
         }
     }
     
     std::ofstream csvFile("large_scale_results.csv");
-    csvFile << "Experiment,Vertices,Edges,Density,Algorithm,Time(ms),Memory(KB),Weight\n";
+    csvFile << "Experiment,Vertices,Edges,Density,Algorithm,Time(ms),Memory(KB),Weight,"
+            << "Representation,GraphMemory(KB),Verified,VerifyTime(ms),Family\n";
     
     for (const auto& exp : experiments) {
-        for (const auto& result : exp.results) {
+        for (size_t i = 0; i < exp.results.size(); ++i) {
+            const auto& result = exp.results[i];
+            csvFile << exp.name << "," << exp.vertices << "," << exp.edges << "," << exp.density << ","
+                   << result.algorithmName << "," << result.executionTime << ","
+                   << result.memoryUsage << "," << result.totalWeight << ","
+                   << "Graph," << exp.graphMemory / 1024 << ","
+                   << exp.checks[i].valid() << "," << exp.checks[i].milliseconds << ","
+                   << GraphGenerator::familyName(exp.family) << "\n";
+        }
+        for (size_t i = 0; i < exp.csrResults.size(); ++i) {
+            const auto& result = exp.csrResults[i];
             csvFile << exp.name << "," << exp.vertices << "," << exp.edges << "," << exp.density << ","
                    << result.algorithmName << "," << result.executionTime << ","
-                   << result.memoryUsage << "," << result.totalWeight << "\n";
+                   << result.memoryUsage << "," << result.totalWeight << ","
+                   << "CSR," << exp.csrMemory / 1024 << ","
+                   << exp.csrChecks[i].valid() << "," << exp.csrChecks[i].milliseconds << ","
+                   << GraphGenerator::familyName(exp.family) << "\n";
         }
     }
     
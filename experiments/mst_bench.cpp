@@ -0,0 +1,242 @@
+#include "../src/data_structures/graph.hpp"
+#include "../src/data_structures/csr_graph.hpp"
+#include "../src/algorithms/algorithm_factory.hpp"
+#include "../src/algorithms/verifier.hpp"
+#include "../src/generators/graph_generator.hpp"
+#include "../src/utils/statistics.hpp"
+#include "../src/utils/timer.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Every option is a comma-separated list where that makes sense; the same keys
+// are accepted as "--key value" on the command line and as "key = value" lines
+// in a --config file, applied in order so later settings win.
+struct BenchConfig {
+    std::vector<std::string> families = {"uniform"};
+    std::vector<int> sizes = {1000, 10000, 100000};
+    std::vector<double> densities = {2.0, 10.0};
+    std::vector<unsigned> seeds = {42};
+    std::vector<std::string> algorithms = {"kruskal", "filter_kruskal", "prim", "prim_indexed", "kkt",
+                                           "kkt_parallel", "boruvka", "boruvka_contract"};
+    std::vector<int> threads = {defaultThreadCount()};
+    std::vector<std::string> representations = {"graph"};
+    int warmup = 1;
+    int repetitions = 5;
+    int rssSampleMilliseconds = 0;
+    bool verify = true;
+    std::string output = "mst_bench_results.csv";
+};
+
+template <typename T>
+std::vector<T> parseList(const std::string& value) {
+    std::vector<T> items;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (item.empty()) continue;
+        std::istringstream parser(item);
+        T parsed;
+        if (!(parser >> parsed)) throw std::invalid_argument("Bad list entry '" + item + "'");
+        items.push_back(parsed);
+    }
+    if (items.empty()) throw std::invalid_argument("Empty list '" + value + "'");
+    return items;
+}
+
+void loadConfigFile(const std::string& path, BenchConfig& config);
+
+void applyOption(const std::string& key, const std::string& value, BenchConfig& config) {
+    if (key == "config") {
+        loadConfigFile(value, config);
+    } else if (key == "families") {
+        config.families = parseList<std::string>(value);
+        for (const auto& family : config.families) GraphGenerator::parseFamily(family);
+    } else if (key == "sizes") {
+        config.sizes = parseList<int>(value);
+    } else if (key == "densities") {
+        config.densities = parseList<double>(value);
+    } else if (key == "seeds") {
+        config.seeds = parseList<unsigned>(value);
+    } else if (key == "algorithms") {
+        config.algorithms = parseList<std::string>(value);
+        for (const auto& name : config.algorithms) AlgorithmFactory::create(name, 1);
+    } else if (key == "threads") {
+        config.threads = parseList<int>(value);
+    } else if (key == "representations") {
+        config.representations = parseList<std::string>(value);
+        for (const auto& representation : config.representations) {
+            if (representation != "graph" && representation != "csr") {
+                throw std::invalid_argument("Unknown representation: " + representation);
+            }
+        }
+    } else if (key == "warmup") {
+        config.warmup = std::stoi(value);
+    } else if (key == "repetitions") {
+        config.repetitions = std::max(1, std::stoi(value));
+    } else if (key == "rss_sample_ms") {
+        config.rssSampleMilliseconds = std::max(0, std::stoi(value));
+    } else if (key == "verify") {
+        config.verify = value == "1" || value == "true" || value == "yes";
+    } else if (key == "output") {
+        config.output = value;
+    } else {
+        throw std::invalid_argument("Unknown option: " + key);
+    }
+}
+
+void loadConfigFile(const std::string& path, BenchConfig& config) {
+    std::ifstream in(path);
+    if (!in) throw std::runtime_error("Cannot open " + path);
+    std::string line;
+    auto trim = [](std::string text) {
+        size_t first = text.find_first_not_of(" \t\r");
+        size_t last = text.find_last_not_of(" \t\r");
+        return first == std::string::npos ? std::string() : text.substr(first, last - first + 1);
+    };
+    while (std::getline(in, line)) {
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+        size_t equals = line.find('=');
+        if (equals == std::string::npos) throw std::invalid_argument(path + ": expected key = value, got '" + line + "'");
+        applyOption(trim(line.substr(0, equals)), trim(line.substr(equals + 1)), config);
+    }
+}
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [--config file] [--families list] [--sizes list] [--densities list]"
+              << std::endl
+              << "       [--seeds list] [--algorithms list] [--threads list] [--representations graph,csr]" << std::endl
+              << "       [--warmup N] [--repetitions N] [--rss_sample_ms N] [--verify 0|1] [--output file.csv]"
+              << std::endl;
+    std::cout << "Families:";
+    for (GraphFamily family : {GraphFamily::Uniform, GraphFamily::RMAT, GraphFamily::Geometric, GraphFamily::KNN,
+                               GraphFamily::PowerLaw, GraphFamily::Grid}) {
+        std::cout << " " << GraphGenerator::familyName(family);
+    }
+    std::cout << std::endl << "Algorithms:";
+    for (const auto& name : AlgorithmFactory::names()) std::cout << " " << name;
+    std::cout << std::endl;
+}
+
+void runBenchmarks(const BenchConfig& config) {
+    std::ofstream csvFile(config.output);
+    csvFile << "Family,Vertices,Edges,Density,Seed,Representation,Algorithm,Threads,Warmup,Reps,"
+            << "Min(ms),Median(ms),P95(ms),Mean(ms),Stddev(ms),CI95Low(ms),CI95High(ms),"
+            << "PeakHeap(KB),Allocated(KB),Allocations,PeakRSS(KB),Weight,Verified,VerifyTime(ms),Status\n";
+
+    for (const auto& familyName : config.families) {
+        GraphFamily family = GraphGenerator::parseFamily(familyName);
+        for (int size : config.sizes) {
+            for (double density : config.densities) {
+                for (unsigned seed : config.seeds) {
+                    Timer timer;
+                    timer.start();
+                    Graph graph = GraphGenerator(seed).generate(family, size, density);
+                    std::optional<CSRGraph> csr;
+                    std::cout << "\n" << familyName << " V=" << graph.getVertices() << " E=" << graph.getEdges()
+                              << " density=" << density << " seed=" << seed << " (generated in " << std::fixed
+                              << std::setprecision(2) << timer.elapsedMilliseconds() << " ms)" << std::defaultfloat
+                              << std::endl;
+
+                    for (const auto& representation : config.representations) {
+                        if (representation == "csr" && !csr) csr.emplace(graph);
+                        for (const auto& name : config.algorithms) {
+                            std::vector<int> threadCounts = config.threads;
+                            if (!AlgorithmFactory::isParallel(name)) threadCounts = {1};
+                            for (int threads : threadCounts) {
+                                auto algorithm = AlgorithmFactory::create(name, threads);
+                                auto solve = [&]() {
+                                    return representation == "csr" ? algorithm->solve(*csr) : algorithm->solve(graph);
+                                };
+                                std::vector<double> times;
+                                MSTResult result;
+                                VerificationReport check;
+                                std::string status = "OK";
+                                try {
+                                    for (int i = 0; i < config.warmup; ++i) solve();
+                                    // Each solve times itself; using executionTime keeps the move into
+                                    // result and the previous repetition's teardown out of the sample.
+                                    for (int i = 0; i < config.repetitions; ++i) {
+                                        result = solve();
+                                        times.push_back(result.executionTime);
+                                    }
+                                    if (config.verify) {
+                                        check = representation == "csr" ? MSTVerifier::verify(*csr, result)
+                                                                        : MSTVerifier::verify(graph, result);
+                                        if (!check.valid()) status = "INVALID";
+                                    }
+                                } catch (const std::exception& e) {
+                                    status = std::string("ERROR: ") + e.what();
+                                }
+
+                                SampleSummary summary = Statistics::summarize(times);
+                                std::cout << "   " << std::setw(36) << std::left
+                                          << (algorithm->getName() + " [" + representation + ", " +
+                                              std::to_string(threads) + "t]")
+                                          << std::right << std::fixed << std::setprecision(2);
+                                if (times.empty()) {
+                                    std::cout << " " << status << std::endl;
+                                } else {
+                                    std::cout << " median " << std::setw(9) << summary.median << " ms, p95 "
+                                              << std::setw(9) << summary.p95 << " ms, mean " << summary.mean
+                                              << " +/- " << (summary.ciHigh - summary.mean) << " ms, heap "
+                                              << result.memoryUsage << " KB";
+                                    if (config.verify) std::cout << ", verify " << check.milliseconds << " ms";
+                                    if (status != "OK") std::cout << " [" << status << "]";
+                                    std::cout << std::endl;
+                                }
+                                std::cout << std::defaultfloat;
+
+                                csvFile << familyName << "," << graph.getVertices() << "," << graph.getEdges() << ","
+                                        << density << "," << seed << "," << representation << ","
+                                        << algorithm->getName() << "," << threads << "," << config.warmup << ","
+                                        << times.size() << "," << summary.min << "," << summary.median << ","
+                                        << summary.p95 << "," << summary.mean << "," << summary.stddev << ","
+                                        << summary.ciLow << "," << summary.ciHigh << "," << result.memoryUsage << ","
+                                        << result.bytesAllocated / 1024 << "," << result.allocations << ","
+                                        << result.peakRssBytes / 1024 << "," << result.totalWeight << ","
+                                        << (config.verify ? std::to_string(check.valid()) : "") << ","
+                                        << check.milliseconds << "," << (status == "OK" || status == "INVALID"
+                                                                              ? status : "ERROR") << "\n";
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    BenchConfig config;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h") {
+                printUsage(argv[0]);
+                return 0;
+            }
+            if (arg.rfind("--", 0) != 0 || i + 1 >= argc) {
+                printUsage(argv[0]);
+                return 1;
+            }
+            applyOption(arg.substr(2), argv[++i], config);
+        }
+        AllocationTracker::setRssSamplingInterval(config.rssSampleMilliseconds);
+        std::cout << "---MST benchmark driver---" << std::endl;
+        std::cout << "Warmup runs: " << config.warmup << ", repetitions: " << config.repetitions
+                  << ", results: " << config.output << std::endl;
+        runBenchmarks(config);
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "../src/generators/graph_generator.hpp"
 #include "../src/algorithms/kkt.hpp"  
 #include "../src/algorithms/boruvka_parallel.hpp"
+#include "../src/algorithms/verifier.hpp"
 #include <iostream>
 #include <fstream>
 #include <vector>
@@ -15,6 +16,7 @@ struct Experiment {
     int vertices;
     double density;
     std::vector<MSTResult> results;
+    std::vector<VerificationReport> checks;
 };
 
 void runSimpleExperiments() {
@@ -52,11 +54,14 @@ void runSimpleExperiments() {
                 std::cout << "   Running " << std::setw(25) << std::left << algo->getName() << "...";
                 std::cout.flush();
                 MSTResult result = algo->solve(graph);
+                VerificationReport check = MSTVerifier::verify(graph, result);
                 exp.results.push_back(result);
+                exp.checks.push_back(check);
                 std::cout << " Time: " << std::setw(8) << std::fixed << std::setprecision(2) 
                           << result.executionTime << " ms"
                           << " Weight: " << std::setw(10) << std::fixed << std::setprecision(2)
-                          << result.totalWeight << std::endl;
+                          << result.totalWeight
+                          << (check.valid() ? " [verified]" : " [INVALID: " + check.message + "]") << std::endl;
             }
             
             experiments.push_back(exp);
@@ -64,13 +69,16 @@ void runSimpleExperiments() {
     }
     
     std::ofstream csvFile("simple_results.csv");
-    csvFile << "Experiment,Vertices,Density,Algorithm,Time(ms),Memory(KB),Weight\n";
+    csvFile << "Experiment,Vertices,Density,Algorithm,Time(ms),Memory(KB),Weight,Verified,VerifyTime(ms)\n";
     
     for (const auto& exp : experiments) {
-        for (const auto& result : exp.results) {
+        for (size_t i = 0; i < exp.results.size(); ++i) {
+            const auto& result = exp.results[i];
+            const auto& check = exp.checks[i];
             csvFile << exp.name << "," << exp.vertices << "," << exp.density << ","
                    << result.algorithmName << "," << result.executionTime << ","
-                   << result.memoryUsage << "," << result.totalWeight << "\n";
+                   << result.memoryUsage << "," << result.totalWeight << ","
+                   << check.valid() << "," << check.milliseconds << "\n";
         }
     }
     
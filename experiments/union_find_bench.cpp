@@ -0,0 +1,121 @@
+#include "../src/data_structures/graph.hpp"
+#include "../src/data_structures/union_find.hpp"
+#include "../src/generators/graph_generator.hpp"
+#include "../src/utils/timer.hpp"
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+struct Workload {
+    std::string name;
+    int vertices;
+    std::vector<std::pair<int, int>> edges;
+};
+
+struct BenchResult {
+    std::string workload;
+    std::string variant;
+    double bestTime;
+    int components;
+};
+
+// Kruskal-style workload: every edge of the graph in ascending weight order.
+Workload makeWorkload(const std::string& name, const Graph& graph) {
+    auto edges = graph.getEdgeList();
+    std::sort(edges.begin(), edges.end(), [](const auto& a, const auto& b) {
+        return std::get<2>(a) < std::get<2>(b);
+    });
+    Workload workload{name, graph.getVertices(), {}};
+    workload.edges.reserve(edges.size());
+    for (const auto& edge : edges) {
+        workload.edges.emplace_back(std::get<0>(edge), std::get<1>(edge));
+    }
+    return workload;
+}
+
+template <typename LinkPolicy, typename CompressPolicy, typename IndexT>
+BenchResult runVariant(const std::string& variant, const Workload& workload, int repetitions) {
+    BenchResult result{workload.name, variant, 0.0, 0};
+    for (int rep = 0; rep < repetitions; ++rep) {
+        Timer timer;
+        timer.start();
+        UnionFind<LinkPolicy, CompressPolicy, IndexT> uf(workload.vertices);
+        IndexT accepted = 0;
+        IndexT target = static_cast<IndexT>(workload.vertices - 1);
+        for (const auto& edge : workload.edges) {
+            if (uf.unite(static_cast<IndexT>(edge.first), static_cast<IndexT>(edge.second))) {
+                if (++accepted == target) break;
+            }
+        }
+        timer.stop();
+        double elapsed = timer.elapsedMilliseconds();
+        if (rep == 0 || elapsed < result.bestTime) {
+            result.bestTime = elapsed;
+        }
+        result.components = static_cast<int>(uf.getComponents());
+    }
+    return result;
+}
+
+template <typename LinkPolicy, typename IndexT>
+void runCompressPolicies(const std::string& prefix, const Workload& workload, int repetitions,
+                         std::vector<BenchResult>& results) {
+    results.push_back(runVariant<LinkPolicy, FullCompression, IndexT>(prefix + "/Full", workload, repetitions));
+    results.push_back(runVariant<LinkPolicy, PathHalving, IndexT>(prefix + "/Halving", workload, repetitions));
+    results.push_back(runVariant<LinkPolicy, PathSplitting, IndexT>(prefix + "/Splitting", workload, repetitions));
+}
+
+template <typename IndexT>
+void runLinkPolicies(const std::string& indexName, const Workload& workload, int repetitions,
+                     std::vector<BenchResult>& results) {
+    runCompressPolicies<UnionByRank, IndexT>("Rank/" + indexName, workload, repetitions, results);
+    runCompressPolicies<UnionBySize, IndexT>("Size/" + indexName, workload, repetitions, results);
+    runCompressPolicies<UnionByIndex, IndexT>("Index/" + indexName, workload, repetitions, results);
+}
+
+void runUnionFindBenchmarks() {
+    std::cout << "---Union-Find variant benchmark---" << std::endl;
+
+    GraphGenerator generator(42);
+    std::vector<Workload> workloads;
+    workloads.push_back(makeWorkload("sparse_V30000_deg8", generator.generateSparseGraph(30000, 8.0)));
+    workloads.push_back(makeWorkload("dense_V3000_d0.3", generator.generateDenseGraph(3000, 0.3)));
+    workloads.push_back(makeWorkload("grid_500x500", generator.generateGridGraph(500, 500)));
+
+    const int repetitions = 5;
+    std::vector<BenchResult> results;
+    for (const auto& workload : workloads) {
+        std::cout << "\n" << workload.name << ": " << workload.vertices << " vertices, "
+                  << workload.edges.size() << " edges" << std::endl;
+        size_t first = results.size();
+        runLinkPolicies<int32_t>("i32", workload, repetitions, results);
+        runLinkPolicies<int64_t>("i64", workload, repetitions, results);
+
+        auto best = std::min_element(results.begin() + first, results.end(),
+                                     [](const BenchResult& a, const BenchResult& b) {
+                                         return a.bestTime < b.bestTime;
+                                     });
+        for (size_t i = first; i < results.size(); ++i) {
+            std::cout << "   " << std::setw(22) << std::left << results[i].variant
+                      << " Time: " << std::setw(8) << std::fixed << std::setprecision(3)
+                      << results[i].bestTime << " ms" << (&results[i] == &*best ? "  <- fastest" : "")
+                      << std::endl;
+        }
+    }
+
+    std::ofstream csvFile("union_find_bench.csv");
+    csvFile << "Workload,Variant,Time(ms),Components\n";
+    for (const auto& result : results) {
+        csvFile << result.workload << "," << result.variant << "," << result.bestTime << ","
+                << result.components << "\n";
+    }
+    csvFile.close();
+}
+
+int main() {
+    runUnionFindBenchmarks();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#include "algorithm_factory.hpp"
+#include "kruskal.hpp"
+#include "filter_kruskal.hpp"
+#include "prim.hpp"
+#include "prim_dense.hpp"
+#include "kkt.hpp"
+#include "kkt_parallel.hpp"
+#include "boruvka_parallel.hpp"
+#include <stdexcept>
+
+const std::vector<std::string>& AlgorithmFactory::names() {
+    static const std::vector<std::string> all = {
+        "kruskal", "filter_kruskal", "prim", "prim_indexed", "prim_dense",
+        "kkt", "kkt_parallel", "boruvka", "boruvka_contract"
+    };
+    return all;
+}
+
+bool AlgorithmFactory::isParallel(const std::string& name) {
+    return name == "kruskal" || name == "filter_kruskal" || name == "kkt_parallel" ||
+           name == "boruvka" || name == "boruvka_contract";
+}
+
+std::unique_ptr<MSTAlgorithm> AlgorithmFactory::create(const std::string& name, int threads) {
+    if (name == "kruskal") return std::make_unique<Kruskal>(threads);
+    if (name == "filter_kruskal") return std::make_unique<FilterKruskal>(threads);
+    if (name == "prim") return std::make_unique<Prim>();
+    if (name == "prim_indexed") return std::make_unique<Prim>(PrimHeap::Indexed);
+    if (name == "prim_dense") return std::make_unique<PrimDense>();
+    if (name == "kkt") return std::make_unique<KKT>();
+    if (name == "kkt_parallel") return std::make_unique<KKTParallel>(threads);
+    if (name == "boruvka") return std::make_unique<BoruvkaParallel>(threads);
+    if (name == "boruvka_contract") return std::make_unique<BoruvkaParallel>(threads, BoruvkaMode::Contract);
+    throw std::invalid_argument("Unknown algorithm: " + name);
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#ifndef ALGORITHM_FACTORY_HPP
+#define ALGORITHM_FACTORY_HPP
+
+#include "mst_algorithm.hpp"
+#include "../utils/parallel.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+// Builds algorithms from the short names used on benchmark command lines:
+// kruskal, filter_kruskal, prim, prim_indexed, prim_dense, kkt, kkt_parallel,
+// boruvka and boruvka_contract.
+class AlgorithmFactory {
+public:
+    static const std::vector<std::string>& names();
+    // Whether the algorithm takes a thread count; the others ignore it.
+    static bool isParallel(const std::string& name);
+    static std::unique_ptr<MSTAlgorithm> create(const std::string& name, int threads = defaultThreadCount());
+};
+
+#endif
\ No newline at end of file
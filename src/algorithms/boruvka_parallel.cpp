@@ -1,11 +1,32 @@
 #include "boruvka_parallel.hpp"
+#include "edge_sort.hpp"
+#include "edge_views.hpp"
 #include "../utils/timer.hpp"
-#include "../utils/memory_monitor.hpp"
+#include "../utils/allocation_tracker.hpp"
 #include <iostream>
 #include <algorithm>
 #include <vector>
-#include <mutex>
-#include <unordered_set>  
+#include <cstdio>
+
+namespace {
+inline void fetchMin(std::atomic<uint64_t>& slot, uint64_t value) {
+    uint64_t current = slot.load(std::memory_order_relaxed);
+    while (value < current &&
+           !slot.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+// Turns per-thread counts into per-thread output offsets and returns the total.
+size_t exclusiveScan(std::vector<size_t>& counts) {
+    size_t running = 0;
+    for (auto& count : counts) {
+        size_t value = count;
+        count = running;
+        running += value;
+    }
+    return running;
+}
+}
 
 MSTResult BoruvkaParallel::solve(const Graph& graph) {
     MSTResult result;
@@ -13,87 +34,254 @@ MSTResult BoruvkaParallel::solve(const Graph& graph) {
     
     Timer timer;
     timer.start();
-    size_t initialMemory = MemoryMonitor::getCurrentMemoryUsage();
+    AllocationTracker::Scope allocations;
     
-    int V = graph.getVertices();
-    const auto& edges = graph.getEdgeListWithIds();
-    UnionFind uf(V);
-    std::unordered_set<int> mstEdgeIds;
-    std::mutex mstMutex;
-    int components = V;
+    buildForest(graph.getVertices(), TupleEdges(graph), result);
     
-    while (components > 1) {
-        std::vector<EdgeInfo> cheapestEdges(V);
-        auto findCheapestEdges = [&](int start, int end) {  
-            for (int i = start; i < end; ++i) {
-                const auto& edge = edges[i];
-                int u = std::get<0>(edge);
-                int v = std::get<1>(edge);
-                double weight = std::get<2>(edge);
-                int id = std::get<3>(edge);
-                if (mstEdgeIds.find(id) != mstEdgeIds.end()) {
-                    continue;
-                }
-                int compU = uf.find(u);
-                int compV = uf.find(v);
-                
-                if (compU != compV) {
-                    if (weight < cheapestEdges[compU].weight) {
-                        cheapestEdges[compU] = EdgeInfo(id, weight, compV, v);
-                    }
-                    if (weight < cheapestEdges[compV].weight) {
-                        cheapestEdges[compV] = EdgeInfo(id, weight, compU, u);
-                    }
-                }
-            }
-        };
-        int edgesPerThread = (edges.size() + numThreads - 1) / numThreads;
-        std::vector<std::thread> threads;
-        for (int i = 0; i < numThreads; ++i) {
-            int start = i * edgesPerThread;
-            int end = std::min(start + edgesPerThread, static_cast<int>(edges.size()));
-            if (start < static_cast<int>(edges.size())) {
-                threads.emplace_back(findCheapestEdges, start, end);
-            }
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+MSTResult BoruvkaParallel::solve(const CSRGraph& graph) {
+    MSTResult result;
+    result.algorithmName = getName();
+
+    Timer timer;
+    timer.start();
+    AllocationTracker::Scope allocations;
+
+    buildForest(graph.getVertices(), ArrayEdges(graph, pool.get()), result);
+
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+template <typename Edges>
+void BoruvkaParallel::buildForest(int V, const Edges& edges, MSTResult& result) {
+    size_t m = edges.size();
+    std::vector<uint32_t> order = EdgeSorter::sortByWeight(m, [&](size_t i) {
+        return edges.weight(i);
+    }, numThreads, pool.get());
+    std::vector<char> inTree(m, 0);
+    scheduler->resetStats();
+
+    int rounds = mode == BoruvkaMode::Scan ? scanRounds(V, edges, order, inTree)
+                                           : contractRounds(V, edges, order, inTree, result);
+    
+    for (size_t i = 0; i < m; ++i) {
+        if (!inTree[i]) continue;
+        result.edges.push_back({edges.u(i), edges.v(i), edges.weight(i)});
+        result.totalWeight += edges.weight(i);
+    }
+    result.metrics["rounds"] = rounds;
+    result.metrics["pool_threads"] = numThreads;
+    for (const auto& [name, value] : scheduler->statsSummary()) {
+        result.metrics[name] = value;
+    }
+}
+
+template <typename Edges>
+int BoruvkaParallel::scanRounds(int V, const Edges& edges, const std::vector<uint32_t>& order,
+                                std::vector<char>& inTree) {
+    size_t m = edges.size();
+    std::vector<uint64_t> packed(m);
+    pool->parallelFor(m, [&](int, size_t begin, size_t end) {
+        for (size_t rank = begin; rank < end; ++rank) {
+            packed[order[rank]] = (static_cast<uint64_t>(rank) << 32) | order[rank];
         }
-        for (auto& thread : threads) {
-            thread.join();
+    });
+
+    ConcurrentUnionFind uf(V);
+    std::vector<std::atomic<uint64_t>> cheapest(V);
+    size_t verticesPerThread = (static_cast<size_t>(V) + numThreads - 1) / numThreads;
+    int rounds = 0;
+    
+    pool->run([&](int tid) {
+        size_t vertexBegin = std::min(static_cast<size_t>(V), tid * verticesPerThread);
+        size_t vertexEnd = std::min(static_cast<size_t>(V), vertexBegin + verticesPerThread);
+        for (size_t c = vertexBegin; c < vertexEnd; ++c) {
+            cheapest[c].store(NO_EDGE, std::memory_order_relaxed);
         }
-        
-        int edgesAdded = 0;
-        for (int comp = 0; comp < V; ++comp) {
-            const EdgeInfo& edgeInfo = cheapestEdges[comp];
-            if (edgeInfo.id != -1) {
-                int compU = comp;
-                int compV = edgeInfo.target_component;
-                if (!uf.connected(compU, compV)) {
-                    uf.unite(compU, compV);
-                    {
-                        std::lock_guard<std::mutex> lock(mstMutex);
-                        mstEdgeIds.insert(edgeInfo.id);
+        int components = V;
+        pool->barrier();
+
+        while (components > 1) {
+            scheduler->collectiveFor(tid, m, [&](int, size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    int compU = uf.find(edges.u(i));
+                    int compV = uf.find(edges.v(i));
+                    if (compU != compV) {
+                        fetchMin(cheapest[compU], packed[i]);
+                        fetchMin(cheapest[compV], packed[i]);
                     }
-                    edgesAdded++;
+                }
+            });
+
+            // Selected edges form a forest (ranks are unique), so every distinct
+            // pick merges two sets; a mutual pick of the same edge by both of its
+            // components unites only once.
+            for (size_t c = vertexBegin; c < vertexEnd; ++c) {
+                uint64_t pick = cheapest[c].load(std::memory_order_relaxed);
+                if (pick == NO_EDGE) continue;
+                cheapest[c].store(NO_EDGE, std::memory_order_relaxed);
+                uint32_t index = static_cast<uint32_t>(pick);
+                if (uf.unite(edges.u(index), edges.v(index))) {
+                    inTree[index] = 1;
                 }
             }
+            pool->barrier();
+
+            int remaining = uf.getComponents();
+            if (tid == 0) rounds++;
+            if (remaining == components) break;
+            components = remaining;
         }
-        
-        if (edgesAdded == 0) {
-            break;
-        }
-        components -= edgesAdded;
-    }
-    const auto& idToEdgeMap = graph.getIdToEdgeMap();
-    for (int id : mstEdgeIds) {
-        auto it = idToEdgeMap.find(id);
-        if (it != idToEdgeMap.end()) {
-            const auto& edge = it->second;
-            result.edges.push_back({std::get<0>(edge), std::get<1>(edge), std::get<2>(edge)});
-            result.totalWeight += std::get<2>(edge);
+    });
+    return rounds;
+}
+
+template <typename Edges>
+int BoruvkaParallel::contractRounds(int V, const Edges& edges, const std::vector<uint32_t>& order,
+                                    std::vector<char>& inTree, MSTResult& result) {
+    size_t m = edges.size();
+    std::vector<int> src(m);
+    std::vector<int> dst(m);
+    std::vector<uint32_t> rank(m);
+    pool->parallelFor(m, [&](int, size_t begin, size_t end) {
+        for (size_t r = begin; r < end; ++r) {
+            src[r] = edges.u(order[r]);
+            dst[r] = edges.v(order[r]);
+            rank[r] = static_cast<uint32_t>(r);
         }
+    });
+
+    std::vector<size_t> counts(numThreads);
+    int n = V;
+    int rounds = 0;
+    while (n > 1 && !src.empty()) {
+        size_t k = src.size();
+        rounds++;
+        char name[32];
+        std::snprintf(name, sizeof(name), "round_%02d_edges", rounds);
+        result.metrics[name] = static_cast<double>(k);
+
+        // Current edges carry dense component ids, so the candidate word packs
+        // the global rank with the position in this round's list.
+        ConcurrentUnionFind uf(n);
+        std::vector<std::atomic<uint64_t>> cheapest(n);
+        pool->parallelFor(n, [&](int, size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c) {
+                cheapest[c].store(NO_EDGE, std::memory_order_relaxed);
+            }
+        });
+        scheduler->parallelFor(k, [&](int, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (src[i] == dst[i]) continue;
+                uint64_t candidate = (static_cast<uint64_t>(rank[i]) << 32) | i;
+                fetchMin(cheapest[src[i]], candidate);
+                fetchMin(cheapest[dst[i]], candidate);
+            }
+        });
+        pool->parallelFor(n, [&](int, size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c) {
+                uint64_t pick = cheapest[c].load(std::memory_order_relaxed);
+                if (pick == NO_EDGE) continue;
+                uint32_t i = static_cast<uint32_t>(pick);
+                if (uf.unite(src[i], dst[i])) {
+                    inTree[order[rank[i]]] = 1;
+                }
+            }
+        });
+        if (uf.getComponents() == n) break;
+
+        std::vector<int> label(n);
+        pool->parallelFor(n, [&](int t, size_t begin, size_t end) {
+            size_t roots = 0;
+            for (size_t c = begin; c < end; ++c) {
+                if (uf.find(c) == static_cast<int>(c)) roots++;
+            }
+            counts[t] = roots;
+        });
+        int next = static_cast<int>(exclusiveScan(counts));
+        pool->parallelFor(n, [&](int t, size_t begin, size_t end) {
+            int id = static_cast<int>(counts[t]);
+            for (size_t c = begin; c < end; ++c) {
+                if (uf.find(c) == static_cast<int>(c)) label[c] = id++;
+            }
+        });
+        std::vector<int> componentOf(n);
+        pool->parallelFor(n, [&](int, size_t begin, size_t end) {
+            for (size_t c = begin; c < end; ++c) {
+                componentOf[c] = label[uf.find(c)];
+            }
+        });
+
+        pool->parallelFor(k, [&](int t, size_t begin, size_t end) {
+            size_t kept = 0;
+            for (size_t i = begin; i < end; ++i) {
+                if (componentOf[src[i]] != componentOf[dst[i]]) kept++;
+            }
+            counts[t] = kept;
+        });
+        size_t crossing = exclusiveScan(counts);
+        std::vector<uint64_t> pairKeys(crossing);
+        std::vector<uint32_t> positions(crossing);
+        pool->parallelFor(k, [&](int t, size_t begin, size_t end) {
+            size_t out = counts[t];
+            for (size_t i = begin; i < end; ++i) {
+                int a = componentOf[src[i]];
+                int b = componentOf[dst[i]];
+                if (a == b) continue;
+                if (a > b) std::swap(a, b);
+                pairKeys[out] = static_cast<uint64_t>(a) * next + b;
+                positions[out] = static_cast<uint32_t>(i);
+                out++;
+            }
+        });
+        EdgeSorter::radixSort(pairKeys, positions, numThreads, pool.get());
+
+        // Each group of equal pair keys is owned by the chunk holding its first
+        // entry and collapses to its lowest-rank edge.
+        auto forEachGroup = [&](size_t begin, size_t end, auto&& emit) {
+            size_t j = begin;
+            while (j < end && j > 0 && pairKeys[j] == pairKeys[j - 1]) j++;
+            while (j < end) {
+                size_t best = j;
+                size_t g = j + 1;
+                while (g < crossing && pairKeys[g] == pairKeys[j]) {
+                    if (rank[positions[g]] < rank[positions[best]]) best = g;
+                    g++;
+                }
+                emit(best);
+                j = g;
+            }
+        };
+        pool->parallelFor(crossing, [&](int t, size_t begin, size_t end) {
+            size_t groups = 0;
+            forEachGroup(begin, end, [&](size_t) { groups++; });
+            counts[t] = groups;
+        });
+        size_t survivors = exclusiveScan(counts);
+        std::vector<int> nextSrc(survivors);
+        std::vector<int> nextDst(survivors);
+        std::vector<uint32_t> nextRank(survivors);
+        pool->parallelFor(crossing, [&](int t, size_t begin, size_t end) {
+            size_t out = counts[t];
+            forEachGroup(begin, end, [&](size_t best) {
+                nextSrc[out] = static_cast<int>(pairKeys[best] / next);
+                nextDst[out] = static_cast<int>(pairKeys[best] % next);
+                nextRank[out] = rank[positions[best]];
+                out++;
+            });
+        });
+        src.swap(nextSrc);
+        dst.swap(nextDst);
+        rank.swap(nextRank);
+        n = next;
     }
-    
-    timer.stop();
-    result.executionTime = timer.elapsedMilliseconds();
-    result.memoryUsage = MemoryMonitor::getCurrentMemoryUsage() - initialMemory;
-    return result;
+    return rounds;
 }
\ No newline at end of file
@@ -2,38 +2,58 @@
 #define BORUVKA_PARALLEL_HPP
 
 #include "mst_algorithm.hpp"
-#include "../data_structures/union_find.hpp"
+#include "../data_structures/concurrent_union_find.hpp"
+#include "../utils/thread_pool.hpp"
+#include "../utils/work_stealing.hpp"
 #include <vector>
 #include <thread>
-#include <mutex>
 #include <atomic>
-#include <limits>
-#include <unordered_set>  
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+
+enum class BoruvkaMode {
+    Scan,      // every round rescans the original edge list through union-find
+    Contract   // every round relabels components and shrinks the edge list
+};
 
 class BoruvkaParallel : public MSTAlgorithm {
 private:
     int numThreads;
+    std::shared_ptr<ThreadPool> pool;
+    BoruvkaMode mode;
+    std::unique_ptr<WorkStealingScheduler> scheduler;
     
 public:
-    BoruvkaParallel(int threads = std::thread::hardware_concurrency()) 
-        : numThreads(threads) {}
+    BoruvkaParallel(int threads = std::thread::hardware_concurrency(), BoruvkaMode boruvkaMode = BoruvkaMode::Scan) 
+        : numThreads(std::max(1, threads)), pool(std::make_shared<ThreadPool>(numThreads)), mode(boruvkaMode),
+          scheduler(std::make_unique<WorkStealingScheduler>(*pool, EDGE_GRAIN)) {}
+    // Runs on a pool that other algorithms may also use (one solve at a time).
+    explicit BoruvkaParallel(std::shared_ptr<ThreadPool> sharedPool, BoruvkaMode boruvkaMode = BoruvkaMode::Scan)
+        : numThreads(sharedPool->size()), pool(std::move(sharedPool)), mode(boruvkaMode),
+          scheduler(std::make_unique<WorkStealingScheduler>(*pool, EDGE_GRAIN)) {}
     MSTResult solve(const Graph& graph) override;
+    MSTResult solve(const CSRGraph& graph) override;
     std::string getName() const override { 
-        return "Boruvka_Parallel_" + std::to_string(numThreads) + "threads"; 
+        return (mode == BoruvkaMode::Scan ? "Boruvka_Parallel_" : "Boruvka_Contracting_") +
+               std::to_string(numThreads) + "threads"; 
     }
     
 private:
-    struct EdgeInfo {
-        int id;
-        double weight;
-        int target_component;
-        int target_vertex;
-        EdgeInfo() : id(-1), weight(std::numeric_limits<double>::max()), 
-                    target_component(-1), target_vertex(-1) {}
-        
-        EdgeInfo(int i, double w, int tc, int tv) 
-            : id(i), weight(w), target_component(tc), target_vertex(tv) {}
-    };
+    // Candidate edges are packed as (weight rank << 32 | edge index); ranks are
+    // unique, so an atomic fetch-min per component picks a deterministic winner.
+    static constexpr uint64_t NO_EDGE = ~uint64_t(0);
+    static constexpr size_t EDGE_GRAIN = 2048;
+
+    // Edges is TupleEdges for Graph input or ArrayEdges for CSR input (edge_views.hpp).
+    template <typename Edges>
+    void buildForest(int V, const Edges& edges, MSTResult& result);
+    // Both fill inTree (indexed like edges); order maps weight rank to edge index.
+    template <typename Edges>
+    int scanRounds(int V, const Edges& edges, const std::vector<uint32_t>& order, std::vector<char>& inTree);
+    template <typename Edges>
+    int contractRounds(int V, const Edges& edges, const std::vector<uint32_t>& order, std::vector<char>& inTree,
+                       MSTResult& result);
 };
 
 #endif
\ No newline at end of file
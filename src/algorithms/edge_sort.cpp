@@ -0,0 +1,74 @@
+#include "edge_sort.hpp"
+#include <array>
+#include <algorithm>
+
+void EdgeSorter::radixSort(std::vector<uint64_t>& keys, std::vector<uint32_t>& indices, int numThreads,
+                           ThreadPool* pool) {
+    size_t n = keys.size();
+    if (n < 2) return;
+    numThreads = pool ? pool->size() : std::max(1, std::min<int>(numThreads, static_cast<int>(n / 4096) + 1));
+    auto parallelFor = [&](int threads, size_t count, auto&& fn) {
+        if (pool) {
+            pool->parallelFor(count, fn);
+        } else {
+            ::parallelFor(threads, count, fn);
+        }
+    };
+
+    std::vector<uint64_t> minKeys(numThreads, UINT64_MAX);
+    std::vector<uint64_t> maxKeys(numThreads, 0);
+    parallelFor(numThreads, n, [&](int t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            minKeys[t] = std::min(minKeys[t], keys[i]);
+            maxKeys[t] = std::max(maxKeys[t], keys[i]);
+        }
+    });
+    uint64_t minKey = *std::min_element(minKeys.begin(), minKeys.end());
+    uint64_t range = *std::max_element(maxKeys.begin(), maxKeys.end()) - minKey;
+    int significantBits = 0;
+    while (significantBits < 64 && (range >> significantBits) != 0) {
+        significantBits++;
+    }
+
+    std::vector<uint64_t> keyBuffer(n);
+    std::vector<uint32_t> indexBuffer(n);
+    std::vector<std::array<size_t, BUCKETS>> counts(numThreads);
+
+    for (int shift = 0; shift < significantBits; shift += RADIX_BITS) {
+        parallelFor(numThreads, n, [&](int t, size_t begin, size_t end) {
+            auto& count = counts[t];
+            count.fill(0);
+            for (size_t i = begin; i < end; ++i) {
+                count[((keys[i] - minKey) >> shift) & (BUCKETS - 1)]++;
+            }
+        });
+
+        bool trivial = false;
+        for (int b = 0; b < BUCKETS && !trivial; ++b) {
+            size_t total = 0;
+            for (int t = 0; t < numThreads; ++t) total += counts[t][b];
+            trivial = total == n;
+        }
+        if (trivial) continue;
+
+        size_t running = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            for (int t = 0; t < numThreads; ++t) {
+                size_t count = counts[t][b];
+                counts[t][b] = running;
+                running += count;
+            }
+        }
+
+        parallelFor(numThreads, n, [&](int t, size_t begin, size_t end) {
+            auto& cursor = counts[t];
+            for (size_t i = begin; i < end; ++i) {
+                size_t pos = cursor[((keys[i] - minKey) >> shift) & (BUCKETS - 1)]++;
+                keyBuffer[pos] = keys[i];
+                indexBuffer[pos] = indices[i];
+            }
+        });
+        keys.swap(keyBuffer);
+        indices.swap(indexBuffer);
+    }
+}
\ No newline at end of file
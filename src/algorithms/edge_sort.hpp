@@ -0,0 +1,55 @@
+#ifndef EDGE_SORT_HPP
+#define EDGE_SORT_HPP
+
+#include "../utils/parallel.hpp"
+#include "../utils/thread_pool.hpp"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// Maps a double to an unsigned key with the same ordering (negative values have
+// all bits flipped, non-negative values only the sign bit), so weights can be
+// radix sorted as integers.
+inline uint64_t weightToKey(double weight) {
+    uint64_t bits;
+    std::memcpy(&bits, &weight, sizeof(bits));
+    return (bits & 0x8000000000000000ULL) ? ~bits : (bits | 0x8000000000000000ULL);
+}
+
+class EdgeSorter {
+public:
+    static constexpr int RADIX_BITS = 11;
+    static constexpr int BUCKETS = 1 << RADIX_BITS;
+
+    // Stable LSD radix sort of the (key, index) struct-of-arrays buffer by key.
+    // Keys are rebased on the minimum so only the bits that actually vary are
+    // sorted; each pass histograms per thread, scatters through per-thread
+    // bucket offsets, and is skipped entirely when every key shares that digit.
+    // With a pool, its workers are used instead of spawning numThreads threads.
+    static void radixSort(std::vector<uint64_t>& keys, std::vector<uint32_t>& indices, int numThreads,
+                          ThreadPool* pool = nullptr);
+
+    // Indices 0..count-1 in ascending weightOf(i) order (ties keep input order).
+    template <typename WeightOf>
+    static std::vector<uint32_t> sortByWeight(size_t count, WeightOf weightOf, int numThreads,
+                                              ThreadPool* pool = nullptr) {
+        std::vector<uint64_t> keys(count);
+        std::vector<uint32_t> indices(count);
+        auto fill = [&](int, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                keys[i] = weightToKey(weightOf(i));
+                indices[i] = static_cast<uint32_t>(i);
+            }
+        };
+        if (pool) {
+            pool->parallelFor(count, fill);
+        } else {
+            parallelFor(numThreads, count, fill);
+        }
+        radixSort(keys, indices, numThreads, pool);
+        return indices;
+    }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,99 @@
+#ifndef EDGE_VIEWS_HPP
+#define EDGE_VIEWS_HPP
+
+#include "../data_structures/graph.hpp"
+#include "../data_structures/csr_graph.hpp"
+#include "../utils/thread_pool.hpp"
+#include <vector>
+#include <tuple>
+#include <cstddef>
+
+// Visits every undirected edge of a CSR graph once, as emit(index, u, v, weight)
+// with u < v, reading the row arrays in place. Indices follow the order of
+// CSRGraph::getEdgeListWithIds(). resize(total) runs once before the first emit.
+// With a pool, rows are split across its participants (two passes over the rows).
+template <typename Resize, typename Emit>
+void forEachCSREdge(const CSRGraph& graph, ThreadPool* pool, Resize&& resize, Emit&& emit) {
+    int V = graph.getVertices();
+    const size_t* offsets = graph.getOffsets();
+    const int* targets = graph.getTargets();
+    const double* weights = graph.getWeights();
+    std::vector<size_t> starts(pool ? pool->size() : 1, 0);
+    auto forRows = [&](auto&& body) {
+        if (pool) {
+            pool->parallelFor(V, body);
+        } else {
+            body(0, 0, static_cast<size_t>(V));
+        }
+    };
+
+    forRows([&](int t, size_t begin, size_t end) {
+        size_t count = 0;
+        for (size_t u = begin; u < end; ++u) {
+            for (size_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+                if (targets[k] > static_cast<int>(u)) count++;
+            }
+        }
+        starts[t] = count;
+    });
+    size_t total = 0;
+    for (auto& start : starts) {
+        size_t count = start;
+        start = total;
+        total += count;
+    }
+    resize(total);
+    forRows([&](int t, size_t begin, size_t end) {
+        size_t index = starts[t];
+        for (size_t u = begin; u < end; ++u) {
+            for (size_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+                if (targets[k] > static_cast<int>(u)) emit(index++, static_cast<int>(u), targets[k], weights[k]);
+            }
+        }
+    });
+}
+
+// Edge-indexed read access, u(i)/v(i)/weight(i) for i < size(), so one
+// algorithm body serves both representations.
+class TupleEdges {
+private:
+    const std::vector<std::tuple<int, int, double, int>>& edges;
+
+public:
+    explicit TupleEdges(const Graph& graph) : edges(graph.getEdgeListWithIds()) {}
+
+    size_t size() const { return edges.size(); }
+    int u(size_t i) const { return std::get<0>(edges[i]); }
+    int v(size_t i) const { return std::get<1>(edges[i]); }
+    double weight(size_t i) const { return std::get<2>(edges[i]); }
+};
+
+// The edges of a CSR graph as three flat arrays, copied straight from its rows.
+class ArrayEdges {
+private:
+    std::vector<int> src;
+    std::vector<int> dst;
+    std::vector<double> weights;
+
+public:
+    ArrayEdges(const CSRGraph& graph, ThreadPool* pool) {
+        forEachCSREdge(graph, pool,
+                       [&](size_t total) {
+                           src.resize(total);
+                           dst.resize(total);
+                           weights.resize(total);
+                       },
+                       [&](size_t i, int a, int b, double w) {
+                           src[i] = a;
+                           dst[i] = b;
+                           weights[i] = w;
+                       });
+    }
+
+    size_t size() const { return src.size(); }
+    int u(size_t i) const { return src[i]; }
+    int v(size_t i) const { return dst[i]; }
+    double weight(size_t i) const { return weights[i]; }
+};
+
+#endif
\ No newline at end of file
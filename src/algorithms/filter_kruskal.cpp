@@ -0,0 +1,200 @@
+#include "filter_kruskal.hpp"
+#include "../utils/timer.hpp"
+#include "../utils/allocation_tracker.hpp"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+MSTResult FilterKruskal::solve(const Graph& graph) {
+    MSTResult result;
+    result.algorithmName = getName();
+
+    Timer timer;
+    timer.start();
+    AllocationTracker::Scope allocations;
+
+    const auto& edgeList = graph.getEdgeList();
+    std::vector<Edge> edges;
+    edges.reserve(edgeList.size());
+    for (const auto& edge : edgeList) {
+        edges.push_back({std::get<2>(edge), std::get<0>(edge), std::get<1>(edge)});
+    }
+    buildForest(graph.getVertices(), edges, result);
+
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+MSTResult FilterKruskal::solve(const CSRGraph& graph) {
+    MSTResult result;
+    result.algorithmName = getName();
+
+    Timer timer;
+    timer.start();
+    AllocationTracker::Scope allocations;
+
+    int V = graph.getVertices();
+    const int* targets = graph.getTargets();
+    const double* weights = graph.getWeights();
+    std::vector<Edge> edges;
+    edges.reserve(graph.getEdges());
+    for (int u = 0; u < V; ++u) {
+        for (size_t k = graph.rowBegin(u); k < graph.rowEnd(u); ++k) {
+            if (targets[k] > u) {
+                edges.push_back({weights[k], u, targets[k]});
+            }
+        }
+    }
+    buildForest(V, edges, result);
+
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+void FilterKruskal::buildForest(int V, std::vector<Edge>& edges, MSTResult& result) {
+    State state(V, result);
+    if (numThreads > 1 && edges.size() >= parallelFilterThreshold) state.scratch.resize(edges.size());
+    scheduler->resetStats();
+    filterKruskal(edges.data(), edges.data() + edges.size(), state);
+    result.metrics["sorted_edges"] = static_cast<double>(state.sortedEdges);
+    result.metrics["filtered_edges"] = static_cast<double>(state.filteredEdges);
+    result.metrics["partitions"] = state.partitions;
+    if (numThreads > 1) {
+        for (const auto& [name, value] : scheduler->statsSummary()) {
+            result.metrics[name] = value;
+        }
+    }
+}
+
+// std::partition for small ranges. Large ones are split into the pool's fixed
+// chunks: each chunk is partitioned in place, then its light and heavy parts are
+// copied to their prefix-sum offsets in the scratch buffer and the result is
+// copied back, so the layout depends only on the thread count.
+template <typename Pred>
+FilterKruskal::Edge* FilterKruskal::partition(Edge* begin, Edge* end, State& state, Pred pred) {
+    size_t n = end - begin;
+    if (numThreads == 1 || n < parallelFilterThreshold) {
+        return std::partition(begin, end, pred);
+    }
+
+    std::vector<size_t> light(numThreads, 0);
+    pool->parallelFor(n, [&](int t, size_t from, size_t to) {
+        light[t] = std::partition(begin + from, begin + to, pred) - (begin + from);
+    });
+    size_t chunk = (n + numThreads - 1) / numThreads;
+    std::vector<size_t> lightAt(numThreads, 0);
+    std::vector<size_t> heavyAt(numThreads, 0);
+    size_t totalLight = 0;
+    for (int t = 0; t < numThreads; ++t) {
+        lightAt[t] = totalLight;
+        totalLight += light[t];
+    }
+    size_t heavy = totalLight;
+    for (int t = 0; t < numThreads; ++t) {
+        size_t from = std::min(n, t * chunk);
+        size_t to = std::min(n, from + chunk);
+        heavyAt[t] = heavy;
+        heavy += to - from - light[t];
+    }
+
+    Edge* scratch = state.scratch.data();
+    pool->parallelFor(n, [&](int t, size_t from, size_t to) {
+        std::memcpy(scratch + lightAt[t], begin + from, light[t] * sizeof(Edge));
+        std::memcpy(scratch + heavyAt[t], begin + from + light[t], (to - from - light[t]) * sizeof(Edge));
+    });
+    pool->parallelFor(n, [&](int, size_t from, size_t to) {
+        std::memcpy(begin + from, scratch + from, (to - from) * sizeof(Edge));
+    });
+    return begin + totalLight;
+}
+
+void FilterKruskal::filterKruskal(Edge* begin, Edge* end, State& state) {
+    if (begin == end || state.done()) return;
+    size_t n = end - begin;
+    if (n <= baseCaseThreshold) {
+        kruskalBaseCase(begin, end, state);
+        return;
+    }
+
+    // Median of a small evenly spaced sample keeps the split balanced without a pass over the range.
+    Edge sample[15];
+    size_t samples = sizeof(sample) / sizeof(sample[0]);
+    for (size_t i = 0; i < samples; ++i) {
+        sample[i] = begin[i * (n - 1) / (samples - 1)];
+    }
+    std::nth_element(sample, sample + samples / 2, sample + samples,
+                     [](const Edge& a, const Edge& b) { return a.weight < b.weight; });
+    double pivot = sample[samples / 2].weight;
+
+    Edge* middle = partition(begin, end, state, [pivot](const Edge& e) { return e.weight <= pivot; });
+    if (middle == end) {
+        // Every weight is <= pivot (pivot is the maximum); split off the pivot-weight edges instead.
+        middle = partition(begin, end, state, [pivot](const Edge& e) { return e.weight < pivot; });
+        if (middle == begin) {
+            kruskalBaseCase(begin, end, state);
+            return;
+        }
+    }
+    state.partitions++;
+
+    filterKruskal(begin, middle, state);
+    if (state.done()) return;
+    Edge* kept = filter(middle, end, state);
+    filterKruskal(middle, kept, state);
+}
+
+void FilterKruskal::kruskalBaseCase(Edge* begin, Edge* end, State& state) {
+    std::sort(begin, end, [](const Edge& a, const Edge& b) { return a.weight < b.weight; });
+    state.sortedEdges += end - begin;
+    for (Edge* e = begin; e != end && !state.done(); ++e) {
+        if (state.uf.unite(e->u, e->v)) {
+            state.result.edges.push_back({e->u, e->v, e->weight});
+            state.result.totalWeight += e->weight;
+        }
+    }
+}
+
+// Compacts [begin, end) to the edges whose endpoints are still in different
+// components and returns the new end. Large ranges are filtered by the
+// work-stealing scheduler: each piece is compacted in place, then the pieces are
+// slid together in range order, so the surviving order does not depend on timing.
+FilterKruskal::Edge* FilterKruskal::filter(Edge* begin, Edge* end, State& state) {
+    size_t n = end - begin;
+    const UnionFind<>& uf = state.uf;
+    auto compact = [&](size_t from, size_t to) {
+        size_t out = from;
+        for (size_t i = from; i < to; ++i) {
+            if (uf.root(begin[i].u) != uf.root(begin[i].v)) {
+                begin[out++] = begin[i];
+            }
+        }
+        return out - from;
+    };
+
+    size_t total = 0;
+    if (numThreads == 1 || n < parallelFilterThreshold) {
+        total = compact(0, n);
+    } else {
+        std::vector<std::vector<std::pair<size_t, size_t>>> pieces(numThreads);
+        scheduler->parallelFor(n, [&](int t, size_t from, size_t to) {
+            pieces[t].push_back({from, compact(from, to)});
+        });
+        std::vector<std::pair<size_t, size_t>> ordered;
+        for (const auto& own : pieces) {
+            ordered.insert(ordered.end(), own.begin(), own.end());
+        }
+        std::sort(ordered.begin(), ordered.end());
+        for (const auto& [from, kept] : ordered) {
+            if (total != from && kept > 0) {
+                std::memmove(begin + total, begin + from, kept * sizeof(Edge));
+            }
+            total += kept;
+        }
+    }
+    state.filteredEdges += n - total;
+    return begin + total;
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#ifndef FILTER_KRUSKAL_HPP
+#define FILTER_KRUSKAL_HPP
+
+#include "mst_algorithm.hpp"
+#include "../data_structures/union_find.hpp"
+#include "../utils/thread_pool.hpp"
+#include "../utils/work_stealing.hpp"
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <memory>
+
+// Filter-Kruskal (Osipov, Sanders, Singler): quicksort-style partitioning around a
+// pivot weight, recursing on the light half first and discarding heavy edges whose
+// endpoints are already connected before they are ever sorted.
+class FilterKruskal : public MSTAlgorithm {
+private:
+    int numThreads;
+    size_t baseCaseThreshold;
+    size_t parallelFilterThreshold;
+    std::unique_ptr<ThreadPool> pool;
+    std::unique_ptr<WorkStealingScheduler> scheduler;
+
+    struct Edge {
+        double weight;
+        int u;
+        int v;
+    };
+
+    struct State {
+        UnionFind<> uf;
+        int V;
+        size_t sortedEdges = 0;
+        size_t filteredEdges = 0;
+        int partitions = 0;
+        // Destination buffer for parallel partitions, sized once per solve.
+        std::vector<Edge> scratch;
+        MSTResult& result;
+
+        State(int vertices, MSTResult& r) : uf(vertices), V(vertices), result(r) {}
+        bool done() const { return result.edges.size() + 1 >= static_cast<size_t>(V); }
+    };
+
+    void buildForest(int V, std::vector<Edge>& edges, MSTResult& result);
+    void filterKruskal(Edge* begin, Edge* end, State& state);
+    void kruskalBaseCase(Edge* begin, Edge* end, State& state);
+    Edge* filter(Edge* begin, Edge* end, State& state);
+    template <typename Pred>
+    Edge* partition(Edge* begin, Edge* end, State& state, Pred pred);
+
+public:
+    // Ranges of at least parallelFilterMin edges are partitioned and filtered on the pool.
+    FilterKruskal(int threads = std::thread::hardware_concurrency(), size_t baseCase = 1024,
+                  size_t parallelFilterMin = 1 << 14)
+        : numThreads(std::max(1, threads)), baseCaseThreshold(std::max<size_t>(baseCase, 2)),
+          parallelFilterThreshold(parallelFilterMin), pool(std::make_unique<ThreadPool>(numThreads)),
+          scheduler(std::make_unique<WorkStealingScheduler>(*pool)) {}
+
+    MSTResult solve(const Graph& graph) override;
+    MSTResult solve(const CSRGraph& graph) override;
+    std::string getName() const override {
+        return "FilterKruskal_" + std::to_string(numThreads) + "threads";
+    }
+};
+
+#endif
\ No newline at end of file
@@ -1,249 +1,271 @@
 #include "kkt.hpp"
-#include "../algorithms/kruskal.hpp"
-#include "../data_structures/union_find.hpp"
+#include "../data_structures/forest_path_max.hpp"
 #include "../utils/timer.hpp"
-#include "../utils/memory_monitor.hpp"
+#include "../utils/allocation_tracker.hpp"
 #include "verifier.hpp"
+#include "edge_views.hpp"
 #include <iostream>
-#include <map>
-#include <unordered_map>
 #include <random>
 #include <algorithm>
 
+namespace {
+// Path-halving find over an arena-backed parent array.
+int findRoot(std::pmr::vector<int>& parent, int x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+}
+
 MSTResult KKT::solve(const Graph& graph) {
     MSTResult result;
     result.algorithmName = getName();
     
     Timer timer;
     timer.start();
-    size_t initialMemory = MemoryMonitor::getCurrentMemoryUsage();
+    AllocationTracker::Scope allocations;
     
-    KKTProblem P(graph.getVertices(), graph.getEdgeListWithIds());
-    std::random_device rd;
-    std::mt19937 rng(rd());
-    
-    auto mstEdgeIds = kktAlgorithm(P, rng());
-    
-    const auto& idToEdgeMap = graph.getIdToEdgeMap();
-    for (int id : mstEdgeIds) {
-        auto it = idToEdgeMap.find(id);
-        if (it != idToEdgeMap.end()) {
-            const auto& edge = it->second;
-            result.edges.push_back({std::get<0>(edge), std::get<1>(edge), std::get<2>(edge)});
-            result.totalWeight += std::get<2>(edge);
-        }
+    const auto& edges = graph.getEdgeListWithIds();
+    KKTProblem P(graph.getVertices(), &arena);
+    P.graph_edges.reserve(edges.size());
+    for (size_t i = 0; i < edges.size(); ++i) {
+        P.graph_edges.push_back({std::get<0>(edges[i]), std::get<1>(edges[i]), std::get<2>(edges[i]),
+                                 static_cast<int>(i)});
     }
+    buildForest(P, result);
 
     timer.stop();
     result.executionTime = timer.elapsedMilliseconds();
-    result.memoryUsage = MemoryMonitor::getCurrentMemoryUsage() - initialMemory;
+    result.recordAllocations(allocations.stop());
     return result;
 }
 
-std::unordered_set<int> KKT::kktAlgorithm(KKTProblem& P, unsigned int seed) {
-    std::unordered_set<int> result;
-    
-    if (P.graph_edges.empty()) return result;
+MSTResult KKT::solve(const CSRGraph& graph) {
+    MSTResult result;
+    result.algorithmName = getName();
 
-    if (P.num_vertices <= 10 || P.graph_edges.size() <= P.num_vertices * 2) {
-        Graph tempGraph(P.num_vertices, false);
-        for (const auto& edge : P.graph_edges) {
-            tempGraph.addEdgeWithId(std::get<0>(edge), std::get<1>(edge), 
-                                   std::get<2>(edge), std::get<3>(edge));
-        }
-        Kruskal kruskal;
-        MSTResult kruskalResult = kruskal.solve(tempGraph);
-        
-        std::unordered_set<int> base_result;
-        for (const auto& mst_edge : kruskalResult.edges) {
-            int mst_u = std::get<0>(mst_edge);
-            int mst_v = std::get<1>(mst_edge);
-            
-            for (const auto& orig_edge : P.graph_edges) {
-                int orig_u = std::get<0>(orig_edge);
-                int orig_v = std::get<1>(orig_edge);
-                int orig_id = std::get<3>(orig_edge);
-                
-                if ((orig_u == mst_u && orig_v == mst_v) || 
-                    (orig_u == mst_v && orig_v == mst_u)) {
-                    base_result.insert(orig_id);
-                    break;
-                }
-            }
+    Timer timer;
+    timer.start();
+    AllocationTracker::Scope allocations;
+
+    KKTProblem P(graph.getVertices(), &arena);
+    forEachCSREdge(graph, nullptr, [&](size_t total) { P.graph_edges.resize(total); },
+                   [&](size_t i, int u, int v, double weight) {
+                       P.graph_edges[i] = {u, v, weight, static_cast<int>(i)};
+                   });
+    buildForest(P, result);
+
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+void KKT::buildForest(const KKTProblem& P, MSTResult& result) {
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    baseCases = 0;
+    baseCaseEdges = 0;
+    baseCaseMilliseconds = 0.0;
+
+    int V = P.num_vertices;
+    const auto& edges = P.graph_edges;
+    std::pmr::vector<int> forest(&arena);
+    forest.reserve(V > 0 ? V - 1 : 0);
+    std::pmr::vector<char> mark(edges.size(), 0, &arena);
+    kktAlgorithm(P, forest, rng(), mark);
+
+    std::pmr::vector<char> selected(edges.size(), 0, &arena);
+    for (int id : forest) selected[id] = 1;
+    for (size_t i = 0; i < edges.size(); ++i) {
+        if (selected[i]) {
+            result.edges.push_back({edges[i].u, edges[i].v, edges[i].weight});
+            result.totalWeight += edges[i].weight;
         }
-        return base_result;
+    }
+
+    result.metrics["base_cases"] = static_cast<double>(baseCases);
+    result.metrics["base_case_edges"] = static_cast<double>(baseCaseEdges);
+    result.metrics["base_case_ms"] = baseCaseMilliseconds;
+    result.metrics["arena_allocations"] = static_cast<double>(arena.getAllocationCount());
+    result.metrics["arena_peak_bytes"] = static_cast<double>(arena.getPeakBytes());
+    result.metrics["arena_requested_bytes"] = static_cast<double>(arena.getBytesRequested());
+    arena.reset();
+}
+
+void KKT::kktAlgorithm(const KKTProblem& P, std::pmr::vector<int>& forest, unsigned int seed,
+                       std::pmr::vector<char>& mark) {
+    if (P.graph_edges.empty()) return;
+
+    if (P.num_vertices <= baseCaseVertices ||
+        static_cast<double>(P.graph_edges.size()) <= baseCaseDensity * P.num_vertices) {
+        kruskalBaseCase(P, forest);
+        return;
     }
     
-    auto [edges1, P1] = boruvkaStep(P);
-    auto [edges2, G] = boruvkaStep(P1);
-    
-    result.insert(edges1.begin(), edges1.end());
-    result.insert(edges2.begin(), edges2.end());
+    KKTProblem P1 = boruvkaStep(P, forest);
+    KKTProblem G = boruvkaStep(P1, forest);
     
     if (G.num_vertices == 0 || G.graph_edges.empty()) {
-        return result;
+        return;
     }
     
     KKTProblem H = randomSampling(G, seed);
-    std::unordered_set<int> F_H = kktAlgorithm(H, seed);
-    
-    std::vector<std::tuple<int, int, double, int>> forest_F;
-    for (const auto& edge : G.graph_edges) {
-        if (F_H.find(std::get<3>(edge)) != F_H.end()) {
-            forest_F.push_back(edge);
-        }
-    }
+    std::pmr::vector<int> forestH(&arena);
+    forestH.reserve(H.num_vertices);
+    kktAlgorithm(H, forestH, seed, mark);
     
-    auto heavy_edges = findHeavyEdges(G.graph_edges, forest_F, G.num_vertices);
-    
-    std::vector<std::tuple<int, int, double, int>> remaining_edges;
-    for (const auto& edge : G.graph_edges) {
-        if (heavy_edges.find(std::get<3>(edge)) == heavy_edges.end()) {
-            remaining_edges.push_back(edge);
+    KKTProblem remaining = removeIsolatedVertices(removeHeavyEdges(G, forestH, mark));
+    kktAlgorithm(remaining, forest, seed, mark);
+}
+
+// Kruskal directly on the subproblem's edges, ties broken by id, appending the
+// ids of the forest edges.
+void KKT::kruskalBaseCase(const KKTProblem& P, std::pmr::vector<int>& forest) {
+    Timer timer;
+    timer.start();
+    const auto& edges = P.graph_edges;
+    std::pmr::vector<uint32_t> order(edges.size(), &arena);
+    for (size_t i = 0; i < order.size(); ++i) order[i] = static_cast<uint32_t>(i);
+    std::sort(order.begin(), order.end(), [&](uint32_t x, uint32_t y) {
+        if (edges[x].weight != edges[y].weight) return edges[x].weight < edges[y].weight;
+        return edges[x].id < edges[y].id;
+    });
+
+    std::pmr::vector<int> parent(P.num_vertices, &arena);
+    for (int i = 0; i < P.num_vertices; ++i) parent[i] = i;
+    int needed = P.num_vertices - 1;
+    for (size_t k = 0; k < order.size() && needed > 0; ++k) {
+        const KKTEdge& e = edges[order[k]];
+        int rootU = findRoot(parent, e.u);
+        int rootV = findRoot(parent, e.v);
+        if (rootU != rootV) {
+            parent[rootU] = rootV;
+            forest.push_back(e.id);
+            needed--;
         }
     }
-    
-    KKTProblem G_remaining(G.num_vertices, remaining_edges);
-    G_remaining = removeIsolatedVertices(G_remaining);
-    
-    auto F_prime = kktAlgorithm(G_remaining, seed);
-    result.insert(F_prime.begin(), F_prime.end());
-    
-    return result;
+    timer.stop();
+    baseCases++;
+    baseCaseEdges += edges.size();
+    baseCaseMilliseconds += timer.elapsedMilliseconds();
 }
 
-std::pair<std::unordered_set<int>, KKTProblem> KKT::boruvkaStep(const KKTProblem& P) {
+// One Boruvka step: every vertex picks its lightest incident edge (ties by
+// position), the picks are contracted, and parallel edges between the new
+// super-vertices are deduplicated by sorting on (u, v, weight, id).
+KKTProblem KKT::boruvkaStep(const KKTProblem& P, std::pmr::vector<int>& forest) {
     int n = P.num_vertices;
-    UnionFind uf(n);
-    std::unordered_set<int> mst_edges;
-    
-    std::unordered_map<int, std::tuple<int, double, int>> min_edge;
-    
-    for (size_t i = 0; i < P.graph_edges.size(); ++i) {
-        const auto& edge = P.graph_edges[i];
-        int u = std::get<0>(edge);
-        int v = std::get<1>(edge);
-        double weight = std::get<2>(edge);
-        int id = std::get<3>(edge);
-        
-        int comp_u = uf.find(u);
-        int comp_v = uf.find(v);
-        
-        if (comp_u != comp_v) {
-            if (min_edge.find(comp_u) == min_edge.end() || weight < std::get<1>(min_edge[comp_u])) {
-                min_edge[comp_u] = {i, weight, comp_v};
-            }
-            if (min_edge.find(comp_v) == min_edge.end() || weight < std::get<1>(min_edge[comp_v])) {
-                min_edge[comp_v] = {i, weight, comp_u};
-            }
-        }
+    const auto& edges = P.graph_edges;
+    std::pmr::vector<int> cheapest(n, -1, &arena);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        const KKTEdge& e = edges[i];
+        if (e.u == e.v) continue;
+        if (cheapest[e.u] == -1 || e.weight < edges[cheapest[e.u]].weight) cheapest[e.u] = static_cast<int>(i);
+        if (cheapest[e.v] == -1 || e.weight < edges[cheapest[e.v]].weight) cheapest[e.v] = static_cast<int>(i);
     }
-    
-    for (const auto& [comp, edge_info] : min_edge) {
-        int edge_idx = std::get<0>(edge_info);
-        const auto& edge = P.graph_edges[edge_idx];
-        int u = std::get<0>(edge);
-        int v = std::get<1>(edge);
-        int id = std::get<3>(edge);
-        
-        if (!uf.connected(u, v)) {
-            uf.unite(u, v);
-            mst_edges.insert(id);
-        }
-    }
-    
-    std::unordered_map<int, int> comp_to_new_id;
-    int new_id = 0;
-    for (int i = 0; i < n; ++i) {
-        int comp = uf.find(i);
-        if (comp_to_new_id.find(comp) == comp_to_new_id.end()) {
-            comp_to_new_id[comp] = new_id++;
+
+    std::pmr::vector<int> parent(n, &arena);
+    for (int i = 0; i < n; ++i) parent[i] = i;
+    for (int u = 0; u < n; ++u) {
+        if (cheapest[u] == -1) continue;
+        const KKTEdge& e = edges[cheapest[u]];
+        int rootU = findRoot(parent, e.u);
+        int rootV = findRoot(parent, e.v);
+        if (rootU != rootV) {
+            parent[rootU] = rootV;
+            forest.push_back(e.id);
         }
     }
-    
-    std::map<std::pair<int, int>, std::tuple<int, double, int>> inter_comp_edges;
-    for (size_t i = 0; i < P.graph_edges.size(); ++i) {
-        const auto& edge = P.graph_edges[i];
-        int u = std::get<0>(edge);
-        int v = std::get<1>(edge);
-        double weight = std::get<2>(edge);
-        int id = std::get<3>(edge);
-        
-        if (mst_edges.find(id) != mst_edges.end()) continue;
-        
-        int comp_u = comp_to_new_id[uf.find(u)];
-        int comp_v = comp_to_new_id[uf.find(v)];
-        
-        if (comp_u != comp_v) {
-            auto key = std::make_pair(std::min(comp_u, comp_v), std::max(comp_u, comp_v));
-            if (inter_comp_edges.find(key) == inter_comp_edges.end() || 
-                weight < std::get<1>(inter_comp_edges[key])) {
-                inter_comp_edges[key] = {i, weight, id};
-            }
-        }
+
+    std::pmr::vector<int> label(n, -1, &arena);
+    int components = 0;
+    for (int u = 0; u < n; ++u) {
+        if (findRoot(parent, u) == u) label[u] = components++;
     }
-    
-    std::vector<std::tuple<int, int, double, int>> contracted_edges;
-    for (const auto& [comp_pair, edge_info] : inter_comp_edges) {
-        double weight = std::get<1>(edge_info);
-        int id = std::get<2>(edge_info);
-        contracted_edges.emplace_back(comp_pair.first, comp_pair.second, weight, id);
+
+    KKTProblem contracted(components, &arena);
+    contracted.graph_edges.reserve(edges.size());
+    for (const KKTEdge& e : edges) {
+        int a = label[findRoot(parent, e.u)];
+        int b = label[findRoot(parent, e.v)];
+        if (a == b) continue;
+        if (a > b) std::swap(a, b);
+        contracted.graph_edges.push_back({a, b, e.weight, e.id});
     }
-    
-    return {mst_edges, KKTProblem(new_id, contracted_edges)};
+    auto& out = contracted.graph_edges;
+    std::sort(out.begin(), out.end(), [](const KKTEdge& x, const KKTEdge& y) {
+        if (x.u != y.u) return x.u < y.u;
+        if (x.v != y.v) return x.v < y.v;
+        if (x.weight != y.weight) return x.weight < y.weight;
+        return x.id < y.id;
+    });
+    out.erase(std::unique(out.begin(), out.end(), [](const KKTEdge& x, const KKTEdge& y) {
+        return x.u == y.u && x.v == y.v;
+    }), out.end());
+    return contracted;
 }
 
 KKTProblem KKT::removeIsolatedVertices(const KKTProblem& P) {
-    std::vector<int> degree(P.num_vertices, 0);
-    
+    std::pmr::vector<int> new_node_id(P.num_vertices, -1, &arena);
     for (const auto& e : P.graph_edges) {
-        int from = std::get<0>(e);
-        int to = std::get<1>(e);
-        degree[from]++;
-        degree[to]++;
+        new_node_id[e.u] = 0;
+        new_node_id[e.v] = 0;
     }
-    
-    std::vector<int> new_node_id(P.num_vertices, -1);
     int next_id = 0;
     for (int i = 0; i < P.num_vertices; ++i) {
-        if (degree[i] > 0) {
+        if (new_node_id[i] != -1) {
             new_node_id[i] = next_id++;
         }
     }
     
-    std::vector<std::tuple<int, int, double, int>> new_edges;
+    KKTProblem compact(next_id, &arena);
+    compact.graph_edges.reserve(P.graph_edges.size());
     for (const auto& e : P.graph_edges) {
-        int from = std::get<0>(e);
-        int to = std::get<1>(e);
-        double cost = std::get<2>(e);
-        int id = std::get<3>(e);
-        
-        if (new_node_id[from] != -1 && new_node_id[to] != -1) {
-            new_edges.emplace_back(new_node_id[from], new_node_id[to], cost, id);
-        }
+        compact.graph_edges.push_back({new_node_id[e.u], new_node_id[e.v], e.weight, e.id});
     }
-    
-    return KKTProblem(next_id, new_edges);
+    return compact;
 }
 
 KKTProblem KKT::randomSampling(const KKTProblem& P, unsigned int seed) {
     std::mt19937 rng(seed);
     std::uniform_real_distribution<double> dist(0.0, 1.0);
     
-    std::vector<std::tuple<int, int, double, int>> H;
-    for (const auto& E : P.graph_edges) {
+    KKTProblem H(P.num_vertices, &arena);
+    H.graph_edges.reserve(P.graph_edges.size() / 2 + 16);
+    for (const auto& e : P.graph_edges) {
         if (dist(rng) < 0.5) {
-            H.push_back(E);
+            H.graph_edges.push_back(e);
         }
     }
-    
-    KKTProblem P_H(P.num_vertices, H);
-    return removeIsolatedVertices(P_H);
+    return removeIsolatedVertices(H);
 }
 
-std::unordered_set<int> KKT::findHeavyEdges(
-    const std::vector<std::tuple<int, int, double, int>>& graph,
-    const std::vector<std::tuple<int, int, double, int>>& forest,
-    int n) {
-    return MSTVerifier::findHeavyEdges(graph, forest, n);
+// Drops the edges of G that are heavier than the path between their endpoints
+// in the forest given by forestIds (ids are shared between G and its sample).
+KKTProblem KKT::removeHeavyEdges(const KKTProblem& G, const std::pmr::vector<int>& forestIds,
+                                 std::pmr::vector<char>& mark) {
+    for (int id : forestIds) mark[id] = 1;
+    std::pmr::vector<std::tuple<int, int, double, int>> forestF(&arena);
+    forestF.reserve(forestIds.size());
+    std::pmr::vector<std::pair<int, int>> queries(&arena);
+    queries.reserve(G.graph_edges.size());
+    for (const auto& e : G.graph_edges) {
+        if (mark[e.id]) forestF.emplace_back(e.u, e.v, e.weight, e.id);
+        queries.emplace_back(e.u, e.v);
+    }
+    for (int id : forestIds) mark[id] = 0;
+
+    std::pmr::vector<double> pathMax = ForestPathMax::query(G.num_vertices, forestF, queries, &arena);
+    KKTProblem light(G.num_vertices, &arena);
+    light.graph_edges.reserve(G.graph_edges.size());
+    for (size_t i = 0; i < G.graph_edges.size(); ++i) {
+        const KKTEdge& e = G.graph_edges[i];
+        if (e.u == e.v || !(e.weight > pathMax[i] + EPSILON)) {
+            light.graph_edges.push_back(e);
+        }
+    }
+    return light;
 }
\ No newline at end of file
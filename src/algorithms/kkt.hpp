@@ -2,42 +2,58 @@
 #define KKT_HPP
 
 #include "mst_algorithm.hpp"
+#include "../utils/arena.hpp"
 #include <vector>
 #include <tuple>
-#include <unordered_set>
+#include <memory_resource>
 
+struct KKTEdge {
+    int u;
+    int v;
+    double weight;
+    int id;
+};
+
+// A (sub)problem over vertices 0..num_vertices-1. Edge ids index the top-level
+// edge list, so selections from any depth map straight back to the input.
+// Storage comes from the solve's arena.
 struct KKTProblem {
     int num_vertices;
-    std::vector<std::tuple<int, int, double, int>> graph_edges; 
-    
-    KKTProblem(int nv = 0, std::vector<std::tuple<int, int, double, int>> ge = {}) 
-        : num_vertices(nv), graph_edges(ge) {}
-    
-    bool operator!=(const KKTProblem& rhs) const {
-        if (num_vertices != rhs.num_vertices) return true;
-        if (graph_edges.size() != rhs.graph_edges.size()) return true;
-        return false;
-    }
-};
+    std::pmr::vector<KKTEdge> graph_edges;
 
+    KKTProblem(int nv, std::pmr::memory_resource* resource) : num_vertices(nv), graph_edges(resource) {}
+};
 
 class KKT : public MSTAlgorithm {
 public:
+    // Subproblems with at most baseCaseVertices vertices or at most
+    // baseCaseDensity * vertices edges are solved directly by Kruskal.
+    explicit KKT(double baseCaseDensity = 2.0, int baseCaseVertices = 10)
+        : baseCaseDensity(baseCaseDensity), baseCaseVertices(baseCaseVertices) {}
+
     MSTResult solve(const Graph& graph) override;
+    MSTResult solve(const CSRGraph& graph) override;
     std::string getName() const override { return "KKT"; }
     
 private:
-    std::unordered_set<int> kktAlgorithm(KKTProblem& P, unsigned int seed = 0);
-    std::pair<std::unordered_set<int>, KKTProblem> boruvkaStep(const KKTProblem& P);
+    double baseCaseDensity;
+    int baseCaseVertices;
+    Arena arena;
+    size_t baseCases = 0;
+    size_t baseCaseEdges = 0;
+    double baseCaseMilliseconds = 0.0;
+
+    // P holds the input edges with their positions as ids; the forest is read back from it.
+    void buildForest(const KKTProblem& P, MSTResult& result);
+    // Appends the ids of the minimum spanning forest of P to forest.
+    void kktAlgorithm(const KKTProblem& P, std::pmr::vector<int>& forest, unsigned int seed,
+                      std::pmr::vector<char>& mark);
+    void kruskalBaseCase(const KKTProblem& P, std::pmr::vector<int>& forest);
+    KKTProblem boruvkaStep(const KKTProblem& P, std::pmr::vector<int>& forest);
     KKTProblem removeIsolatedVertices(const KKTProblem& P);
     KKTProblem randomSampling(const KKTProblem& P, unsigned int seed = 0);
-    std::unordered_set<int> findHeavyEdges(
-        const std::vector<std::tuple<int, int, double, int>>& graph,
-        const std::vector<std::tuple<int, int, double, int>>& forest,
-        int n);
-    int getSolutionCost(const KKTProblem& P, const std::unordered_set<int>& used);
-    std::vector<std::tuple<int, int, double, int>> getMSTEdgesFromProblem(
-        const std::unordered_set<int>& mst_id, const KKTProblem& P);
+    KKTProblem removeHeavyEdges(const KKTProblem& G, const std::pmr::vector<int>& forestIds,
+                                std::pmr::vector<char>& mark);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,322 @@
+#include "kkt_parallel.hpp"
+#include "edge_sort.hpp"
+#include "edge_views.hpp"
+#include "verifier.hpp"
+#include "../data_structures/concurrent_union_find.hpp"
+#include "../data_structures/forest_path_max.hpp"
+#include "../utils/timer.hpp"
+#include "../utils/allocation_tracker.hpp"
+#include "../utils/random.hpp"
+#include <atomic>
+#include <limits>
+#include <climits>
+
+namespace {
+template <typename T>
+inline void fetchMin(std::atomic<T>& slot, T value) {
+    T current = slot.load(std::memory_order_relaxed);
+    while (value < current &&
+           !slot.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+}
+
+MSTResult KKTParallel::solve(const Graph& graph) {
+    MSTResult result;
+    result.algorithmName = getName();
+
+    Timer timer;
+    timer.start();
+    AllocationTracker::Scope allocations;
+
+    const auto& edges = graph.getEdgeListWithIds();
+    KKTProblem P(graph.getVertices(), &arena);
+    P.graph_edges.resize(edges.size());
+    pool->parallelFor(edges.size(), [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            P.graph_edges[i] = {std::get<0>(edges[i]), std::get<1>(edges[i]), std::get<2>(edges[i]),
+                                static_cast<int>(i)};
+        }
+    });
+    buildForest(P, result);
+
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+MSTResult KKTParallel::solve(const CSRGraph& graph) {
+    MSTResult result;
+    result.algorithmName = getName();
+
+    Timer timer;
+    timer.start();
+    AllocationTracker::Scope allocations;
+
+    KKTProblem P(graph.getVertices(), &arena);
+    forEachCSREdge(graph, pool.get(), [&](size_t total) { P.graph_edges.resize(total); },
+                   [&](size_t i, int u, int v, double weight) {
+                       P.graph_edges[i] = {u, v, weight, static_cast<int>(i)};
+                   });
+    buildForest(P, result);
+
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+template <typename Keep, typename Resize, typename Emit>
+void KKTParallel::compact(size_t n, Keep keep, Resize resize, Emit emit) {
+    pool->parallelFor(n, [&](int t, size_t begin, size_t end) {
+        size_t kept = 0;
+        for (size_t i = begin; i < end; ++i) {
+            if (keep(i)) kept++;
+        }
+        counts[t] = kept;
+    });
+    size_t total = 0;
+    for (auto& count : counts) {
+        size_t value = count;
+        count = total;
+        total += value;
+    }
+    resize(total);
+    pool->parallelFor(n, [&](int t, size_t begin, size_t end) {
+        size_t out = counts[t];
+        for (size_t i = begin; i < end; ++i) {
+            if (keep(i)) emit(out++, i);
+        }
+    });
+}
+
+void KKTParallel::buildForest(const KKTProblem& P, MSTResult& result) {
+    nextStream = 0;
+    heavyEdges = 0;
+    mark.assign(P.graph_edges.size(), 0);
+
+    int V = P.num_vertices;
+    std::pmr::vector<int> forest(&arena);
+    forest.reserve(V > 0 ? V - 1 : 0);
+    kktAlgorithm(P, forest);
+
+    std::sort(forest.begin(), forest.end());
+    for (int id : forest) {
+        const KKTEdge& edge = P.graph_edges[id];
+        result.edges.push_back({edge.u, edge.v, edge.weight});
+        result.totalWeight += edge.weight;
+    }
+
+    result.metrics["heavy_edges"] = static_cast<double>(heavyEdges);
+    result.metrics["samples"] = static_cast<double>(nextStream);
+    result.metrics["arena_allocations"] = static_cast<double>(arena.getAllocationCount());
+    result.metrics["arena_peak_bytes"] = static_cast<double>(arena.getPeakBytes());
+    arena.reset();
+}
+
+void KKTParallel::kktAlgorithm(const KKTProblem& P, std::pmr::vector<int>& forest) {
+    if (P.graph_edges.empty()) return;
+
+    if (P.num_vertices <= 10 || P.graph_edges.size() <= static_cast<size_t>(P.num_vertices) * 2) {
+        KKTProblem rest = boruvkaStep(P, forest);
+        while (!rest.graph_edges.empty()) {
+            rest = boruvkaStep(rest, forest);
+        }
+        return;
+    }
+
+    KKTProblem P1 = boruvkaStep(P, forest);
+    KKTProblem G = boruvkaStep(P1, forest);
+    if (G.num_vertices == 0 || G.graph_edges.empty()) {
+        return;
+    }
+
+    KKTProblem H = randomSampling(G);
+    std::pmr::vector<int> forestH(&arena);
+    forestH.reserve(H.num_vertices);
+    kktAlgorithm(H, forestH);
+
+    KKTProblem remaining = removeIsolatedVertices(removeHeavyEdges(G, forestH));
+    kktAlgorithm(remaining, forest);
+}
+
+// Every vertex picks its lightest incident edge, ties broken by position, so
+// the picks form a forest; hooking is a concurrent union-find pass and the
+// contracted multigraph is deduplicated by radix sorting on the endpoint pair.
+KKTProblem KKTParallel::boruvkaStep(const KKTProblem& P, std::pmr::vector<int>& forest) {
+    int n = P.num_vertices;
+    const auto& edges = P.graph_edges;
+    size_t m = edges.size();
+
+    std::pmr::vector<std::atomic<uint64_t>> lightest(n, &arena);
+    std::pmr::vector<std::atomic<int>> pick(n, &arena);
+    pool->parallelFor(n, [&](int, size_t begin, size_t end) {
+        for (size_t u = begin; u < end; ++u) {
+            lightest[u].store(UINT64_MAX, std::memory_order_relaxed);
+            pick[u].store(INT_MAX, std::memory_order_relaxed);
+        }
+    });
+    pool->parallelFor(m, [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const KKTEdge& e = edges[i];
+            if (e.u == e.v) continue;
+            uint64_t key = weightToKey(e.weight);
+            fetchMin(lightest[e.u], key);
+            fetchMin(lightest[e.v], key);
+        }
+    });
+    pool->parallelFor(m, [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const KKTEdge& e = edges[i];
+            if (e.u == e.v) continue;
+            uint64_t key = weightToKey(e.weight);
+            if (lightest[e.u].load(std::memory_order_relaxed) == key) fetchMin(pick[e.u], static_cast<int>(i));
+            if (lightest[e.v].load(std::memory_order_relaxed) == key) fetchMin(pick[e.v], static_cast<int>(i));
+        }
+    });
+
+    ConcurrentUnionFind uf(n);
+    std::pmr::vector<int> hooked(n, -1, &arena);
+    pool->parallelFor(n, [&](int, size_t begin, size_t end) {
+        for (size_t u = begin; u < end; ++u) {
+            int i = pick[u].load(std::memory_order_relaxed);
+            if (i != INT_MAX && uf.unite(edges[i].u, edges[i].v)) {
+                hooked[u] = edges[i].id;
+            }
+        }
+    });
+    size_t before = forest.size();
+    compact(n, [&](size_t u) { return hooked[u] != -1; },
+            [&](size_t total) { forest.resize(before + total); },
+            [&](size_t out, size_t u) { forest[before + out] = hooked[u]; });
+
+    std::pmr::vector<int> label(n, &arena);
+    int components = 0;
+    compact(n, [&](size_t u) { return uf.find(static_cast<int>(u)) == static_cast<int>(u); },
+            [&](size_t total) { components = static_cast<int>(total); },
+            [&](size_t out, size_t u) { label[u] = static_cast<int>(out); });
+    std::pmr::vector<int> componentOf(n, &arena);
+    pool->parallelFor(n, [&](int, size_t begin, size_t end) {
+        for (size_t u = begin; u < end; ++u) {
+            componentOf[u] = label[uf.find(static_cast<int>(u))];
+        }
+    });
+
+    std::vector<uint64_t> pairKeys;
+    std::vector<uint32_t> positions;
+    compact(m, [&](size_t i) { return componentOf[edges[i].u] != componentOf[edges[i].v]; },
+            [&](size_t total) { pairKeys.resize(total); positions.resize(total); },
+            [&](size_t out, size_t i) {
+                int a = componentOf[edges[i].u];
+                int b = componentOf[edges[i].v];
+                if (a > b) std::swap(a, b);
+                pairKeys[out] = static_cast<uint64_t>(a) * components + b;
+                positions[out] = static_cast<uint32_t>(i);
+            });
+    EdgeSorter::radixSort(pairKeys, positions, numThreads, pool.get());
+
+    // A group of equal pair keys belongs to the chunk that holds its first
+    // entry and collapses to its lightest edge (lowest id on ties).
+    size_t crossing = pairKeys.size();
+    auto lighter = [&](uint32_t x, uint32_t y) {
+        if (edges[x].weight != edges[y].weight) return edges[x].weight < edges[y].weight;
+        return edges[x].id < edges[y].id;
+    };
+    auto groupBest = [&](size_t j) {
+        if (j > 0 && pairKeys[j] == pairKeys[j - 1]) return SIZE_MAX;
+        size_t best = j;
+        for (size_t g = j + 1; g < crossing && pairKeys[g] == pairKeys[j]; ++g) {
+            if (lighter(positions[g], positions[best])) best = g;
+        }
+        return best;
+    };
+    KKTProblem contracted(components, &arena);
+    compact(crossing, [&](size_t j) { return j == 0 || pairKeys[j] != pairKeys[j - 1]; },
+            [&](size_t total) { contracted.graph_edges.resize(total); },
+            [&](size_t out, size_t j) {
+                const KKTEdge& e = edges[positions[groupBest(j)]];
+                contracted.graph_edges[out] = {static_cast<int>(pairKeys[j] / components),
+                                               static_cast<int>(pairKeys[j] % components), e.weight, e.id};
+            });
+    return contracted;
+}
+
+KKTProblem KKTParallel::removeIsolatedVertices(const KKTProblem& P) {
+    int n = P.num_vertices;
+    const auto& edges = P.graph_edges;
+    std::pmr::vector<std::atomic<char>> used(n, &arena);
+    pool->parallelFor(n, [&](int, size_t begin, size_t end) {
+        for (size_t u = begin; u < end; ++u) used[u].store(0, std::memory_order_relaxed);
+    });
+    pool->parallelFor(edges.size(), [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            used[edges[i].u].store(1, std::memory_order_relaxed);
+            used[edges[i].v].store(1, std::memory_order_relaxed);
+        }
+    });
+
+    std::pmr::vector<int> newId(n, &arena);
+    int next = 0;
+    compact(n, [&](size_t u) { return used[u].load(std::memory_order_relaxed) != 0; },
+            [&](size_t total) { next = static_cast<int>(total); },
+            [&](size_t out, size_t u) { newId[u] = static_cast<int>(out); });
+
+    KKTProblem compactP(next, &arena);
+    compactP.graph_edges.resize(edges.size());
+    pool->parallelFor(edges.size(), [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const KKTEdge& e = edges[i];
+            compactP.graph_edges[i] = {newId[e.u], newId[e.v], e.weight, e.id};
+        }
+    });
+    return compactP;
+}
+
+// Keeps each edge with probability 1/2. The coin for an edge depends only on
+// the seed, the sampling call and the edge id.
+KKTProblem KKTParallel::randomSampling(const KKTProblem& P) {
+    CounterRng rng(seed);
+    uint64_t stream = nextStream++;
+    const auto& edges = P.graph_edges;
+    KKTProblem H(P.num_vertices, &arena);
+    compact(edges.size(), [&](size_t i) { return rng.uniform(stream, edges[i].id) < 0.5; },
+            [&](size_t total) { H.graph_edges.resize(total); },
+            [&](size_t out, size_t i) { H.graph_edges[out] = edges[i]; });
+    return removeIsolatedVertices(H);
+}
+
+// F-heavy filtering: the sample forest is rooted and lifted once, then every
+// edge's path-maximum query is an independent O(log n) climb run in parallel.
+KKTProblem KKTParallel::removeHeavyEdges(const KKTProblem& G, const std::pmr::vector<int>& forestIds) {
+    int n = G.num_vertices;
+    const auto& edges = G.graph_edges;
+    size_t m = edges.size();
+    for (int id : forestIds) mark[id] = 1;
+    std::pmr::vector<int> forestU(&arena);
+    std::pmr::vector<int> forestV(&arena);
+    std::pmr::vector<double> forestWeight(&arena);
+    compact(m, [&](size_t i) { return mark[edges[i].id] != 0; },
+            [&](size_t total) { forestU.resize(total); forestV.resize(total); forestWeight.resize(total); },
+            [&](size_t out, size_t i) {
+                forestU[out] = edges[i].u;
+                forestV[out] = edges[i].v;
+                forestWeight[out] = edges[i].weight;
+            });
+    for (int id : forestIds) mark[id] = 0;
+    LiftedForest lifted(n, forestU.size(), forestU.data(), forestV.data(), forestWeight.data(), pool.get(), &arena);
+
+    std::pmr::vector<char> light(m, &arena);
+    pool->parallelFor(m, [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const KKTEdge& e = edges[i];
+            light[i] = e.u == e.v || !(e.weight > lifted.pathMax(e.u, e.v) + EPSILON);
+        }
+    });
+    KKTProblem filtered(n, &arena);
+    compact(m, [&](size_t i) { return light[i] != 0; },
+            [&](size_t total) { filtered.graph_edges.resize(total); },
+            [&](size_t out, size_t i) { filtered.graph_edges[out] = edges[i]; });
+    heavyEdges += m - filtered.graph_edges.size();
+    return filtered;
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef KKT_PARALLEL_HPP
+#define KKT_PARALLEL_HPP
+
+#include "mst_algorithm.hpp"
+#include "kkt.hpp"
+#include "../utils/arena.hpp"
+#include "../utils/thread_pool.hpp"
+#include <vector>
+#include <thread>
+#include <memory>
+#include <cstdint>
+#include <algorithm>
+
+// Karger-Klein-Tarjan with every per-edge pass data-parallel on one thread
+// pool: Boruvka contraction (atomic min per vertex, parallel relabel and
+// radix-sort dedup), Bernoulli sampling from a counter-based RNG keyed by edge
+// id, and heavy-edge filtering with binary-lifting path maxima. Results depend
+// only on the seed, not on the thread count.
+class KKTParallel : public MSTAlgorithm {
+public:
+    KKTParallel(int threads = std::thread::hardware_concurrency(), uint64_t seed = 1)
+        : numThreads(std::max(1, threads)), seed(seed), pool(std::make_unique<ThreadPool>(numThreads)),
+          counts(numThreads) {}
+
+    MSTResult solve(const Graph& graph) override;
+    MSTResult solve(const CSRGraph& graph) override;
+    std::string getName() const override {
+        return "KKT_Parallel_" + std::to_string(numThreads) + "threads";
+    }
+
+private:
+    int numThreads;
+    uint64_t seed;
+    std::unique_ptr<ThreadPool> pool;
+    Arena arena;
+    std::vector<size_t> counts;
+    std::vector<char> mark;
+    uint64_t nextStream = 0;
+    size_t heavyEdges = 0;
+
+    // P holds the input edges with their positions as ids; the forest is read back from it.
+    void buildForest(const KKTProblem& P, MSTResult& result);
+    void kktAlgorithm(const KKTProblem& P, std::pmr::vector<int>& forest);
+    KKTProblem boruvkaStep(const KKTProblem& P, std::pmr::vector<int>& forest);
+    KKTProblem removeIsolatedVertices(const KKTProblem& P);
+    KKTProblem randomSampling(const KKTProblem& P);
+    KKTProblem removeHeavyEdges(const KKTProblem& G, const std::pmr::vector<int>& forestIds);
+
+    // Order-preserving parallel filter over [0, n): resize(total) is called
+    // once, then emit(position, i) for every i with keep(i).
+    template <typename Keep, typename Resize, typename Emit>
+    void compact(size_t n, Keep keep, Resize resize, Emit emit);
+};
+
+#endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "kruskal.hpp"
+#include "edge_sort.hpp"
 #include "../utils/timer.hpp"
-#include "../utils/memory_monitor.hpp"
+#include "../utils/allocation_tracker.hpp"
 #include <algorithm>
 #include <iostream>
 
@@ -16,20 +17,70 @@ MSTResult Kruskal::solve(const Graph& graph) {
     Timer timer;
     timer.start();
 
-    size_t initialMemory = MemoryMonitor::getCurrentMemoryUsage();
-    int V = graph.getVertices();
-    const auto& edges = graph.getEdgeList();
+    AllocationTracker::Scope allocations;
+    std::vector<std::tuple<int, int, double>> sortedEdges = graph.getEdgeList();
+    buildForest(graph.getVertices(), sortedEdges, result);
     
-    std::vector<std::tuple<int, int, double>> sortedEdges = edges;
-    std::sort(sortedEdges.begin(), sortedEdges.end(), compareEdges);
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+MSTResult Kruskal::solve(const CSRGraph& graph) {
+    MSTResult result;
+    result.algorithmName = getName();
+
+    Timer timer;
+    timer.start();
+
+    AllocationTracker::Scope allocations;
+    int V = graph.getVertices();
+    const int* targets = graph.getTargets();
+    const double* weights = graph.getWeights();
+    std::vector<std::tuple<int, int, double>> sortedEdges;
+    sortedEdges.reserve(graph.getEdges());
+    for (int u = 0; u < V; ++u) {
+        for (size_t k = graph.rowBegin(u); k < graph.rowEnd(u); ++k) {
+            if (targets[k] > u) {
+                sortedEdges.emplace_back(u, targets[k], weights[k]);
+            }
+        }
+    }
+    buildForest(V, sortedEdges, result);
+
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+void Kruskal::buildForest(int V, std::vector<std::tuple<int, int, double>>& edges, MSTResult& result) {
+    Timer phaseTimer;
+    phaseTimer.start();
+    std::vector<uint32_t> order;
+    bool useRadix = edges.size() >= radixThreshold;
+    if (useRadix) {
+        order = EdgeSorter::sortByWeight(edges.size(), [&](size_t i) { return std::get<2>(edges[i]); },
+                                         numThreads);
+    } else {
+        std::sort(edges.begin(), edges.end(), compareEdges);
+    }
+    phaseTimer.stop();
+    double sortTime = phaseTimer.elapsedMilliseconds();
+    result.metrics["sort_ms"] = sortTime;
+    result.metrics["sort_edges_per_s"] = sortTime > 0 ? edges.size() / (sortTime / 1000.0) : 0.0;
+    result.metrics["radix_sort"] = useRadix ? 1.0 : 0.0;
+
+    phaseTimer.start();
     UnionFind uf(V);
     result.totalWeight = 0.0;
-    for (const auto& edge : sortedEdges) {
+    for (size_t i = 0; i < edges.size(); ++i) {
+        const auto& edge = useRadix ? edges[order[i]] : edges[i];
         int u = std::get<0>(edge);
         int v = std::get<1>(edge);
         double weight = std::get<2>(edge);
-        if (!uf.connected(u, v)) {
-            uf.unite(u, v);
+        if (uf.unite(u, v)) {
             result.edges.push_back(edge);
             result.totalWeight += weight;
             if (result.edges.size() == static_cast<size_t>(V - 1)) {
@@ -37,9 +88,6 @@ MSTResult Kruskal::solve(const Graph& graph) {
             }
         }
     }
-    
-    timer.stop();
-    result.executionTime = timer.elapsedMilliseconds();
-    result.memoryUsage = MemoryMonitor::getCurrentMemoryUsage() - initialMemory;
-    return result;
+    phaseTimer.stop();
+    result.metrics["union_find_ms"] = phaseTimer.elapsedMilliseconds();
 }
\ No newline at end of file
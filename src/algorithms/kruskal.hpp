@@ -4,15 +4,27 @@
 #include "mst_algorithm.hpp"
 #include "../data_structures/union_find.hpp"
 #include <algorithm>
+#include <thread>
 
 class Kruskal : public MSTAlgorithm {
+private:
+    int numThreads;
+    size_t radixThreshold;
+
 public:
+    // Edge lists with at least radixThreshold edges are sorted with the parallel
+    // radix EdgeSorter instead of std::sort.
+    Kruskal(int threads = std::thread::hardware_concurrency(), size_t radixSortThreshold = 1 << 16)
+        : numThreads(std::max(1, threads)), radixThreshold(radixSortThreshold) {}
+
     MSTResult solve(const Graph& graph) override;
+    MSTResult solve(const CSRGraph& graph) override;
     std::string getName() const override { return "Kruskal"; }
     
 private:
     static bool compareEdges(const std::tuple<int, int, double>& a, 
                            const std::tuple<int, int, double>& b);
+    void buildForest(int V, std::vector<std::tuple<int, int, double>>& edges, MSTResult& result);
 };
 
 #endif
\ No newline at end of file
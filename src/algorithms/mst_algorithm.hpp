@@ -2,23 +2,55 @@
 #define MST_ALGORITHM_HPP
 
 #include "../data_structures/graph.hpp"
+#include "../data_structures/csr_graph.hpp"
+#include "../utils/allocation_tracker.hpp"
 #include <vector>
 #include <string>
+#include <map>
+#include <sstream>
 
 struct MSTResult {
     std::vector<std::tuple<int, int, double>> edges; 
     double totalWeight;
     double executionTime;
+    // Peak live heap during solve in KB, plus the raw allocator counters behind it.
     size_t memoryUsage;
+    size_t bytesAllocated;
+    size_t allocations;
+    size_t peakHeapBytes;
+    // Peak RSS while solving; 0 unless AllocationTracker RSS sampling is on.
+    size_t peakRssBytes;
     std::string algorithmName;
+    // Optional per-algorithm breakdown (phase times, counters), keyed by name.
+    std::map<std::string, double> metrics;
     
-    MSTResult() : totalWeight(0.0), executionTime(0.0), memoryUsage(0) {}
+    MSTResult()
+        : totalWeight(0.0), executionTime(0.0), memoryUsage(0), bytesAllocated(0), allocations(0),
+          peakHeapBytes(0), peakRssBytes(0) {}
+
+    void recordAllocations(const AllocationStats& stats) {
+        bytesAllocated = stats.bytesAllocated;
+        allocations = stats.allocations;
+        peakHeapBytes = stats.peakBytes;
+        peakRssBytes = stats.peakRssBytes;
+        memoryUsage = (stats.peakBytes + 1023) / 1024;
+    }
+
+    std::string metricsSummary() const {
+        std::ostringstream out;
+        for (const auto& [name, value] : metrics) {
+            if (out.tellp() > 0) out << ", ";
+            out << name << "=" << value;
+        }
+        return out.str();
+    }
 };
 
 class MSTAlgorithm {
 public:
     virtual ~MSTAlgorithm() = default;
     virtual MSTResult solve(const Graph& graph) = 0;
+    virtual MSTResult solve(const CSRGraph& graph) = 0;
     virtual std::string getName() const = 0;
 };
 
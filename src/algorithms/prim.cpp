@@ -1,52 +1,161 @@
 #include "prim.hpp"
+#include "prim_dense.hpp"
+#include "../data_structures/indexed_dary_heap.hpp"
 #include "../utils/timer.hpp"
-#include "../utils/memory_monitor.hpp"
+#include "../utils/allocation_tracker.hpp"
 #include <queue>
 #include <vector>
 #include <functional>
 #include <limits>
 #include <iostream>
 
+bool Prim::useDense(int V, size_t E) const {
+    return V > 0 && static_cast<double>(E) / (static_cast<double>(V) * V) > denseThreshold &&
+           PrimDense::fitsInMemory(V);
+}
+
+template <typename GraphT>
+MSTResult Prim::solveDense(const GraphT& graph) const {
+    PrimDense dense;
+    MSTResult result = dense.solve(graph);
+    result.algorithmName = getName();
+    result.metrics["dense_dispatch"] = 1.0;
+    return result;
+}
+
 MSTResult Prim::solve(const Graph& graph) {
+    if (useDense(graph.getVertices(), graph.getEdges())) {
+        return solveDense(graph);
+    }
     MSTResult result;
     result.algorithmName = getName();
     Timer timer;
     timer.start();
-    size_t initialMemory = MemoryMonitor::getCurrentMemoryUsage();
-    int V = graph.getVertices();
+    AllocationTracker::Scope allocations;
     const auto& adjList = graph.getAdjList();
+    buildTree(graph.getVertices(), [&](int u, auto&& visit) {
+        for (const auto& neighbor : adjList[u]) {
+            visit(neighbor.first, neighbor.second);
+        }
+    }, result);
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+MSTResult Prim::solve(const CSRGraph& graph) {
+    if (useDense(graph.getVertices(), graph.getEdges())) {
+        return solveDense(graph);
+    }
+    MSTResult result;
+    result.algorithmName = getName();
+    Timer timer;
+    timer.start();
+    AllocationTracker::Scope allocations;
+    const int* targets = graph.getTargets();
+    const double* weights = graph.getWeights();
+    buildTree(graph.getVertices(), [&](int u, auto&& visit) {
+        for (size_t k = graph.rowBegin(u); k < graph.rowEnd(u); ++k) {
+            visit(targets[k], weights[k]);
+        }
+    }, result);
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+template <typename ForEachNeighbor>
+void Prim::buildTree(int V, ForEachNeighbor forEachNeighbor, MSTResult& result) {
+    if (heap == PrimHeap::Lazy) {
+        buildTreeLazy(V, forEachNeighbor, result);
+    } else {
+        buildTreeIndexed(V, forEachNeighbor, result);
+    }
+}
+
+template <typename ForEachNeighbor>
+void Prim::buildTreeLazy(int V, ForEachNeighbor forEachNeighbor, MSTResult& result) {
     std::vector<bool> inMST(V, false);
     std::vector<double> key(V, std::numeric_limits<double>::max());
     std::vector<int> parent(V, -1);
     std::priority_queue<std::pair<double, int>, 
                        std::vector<std::pair<double, int>>,
                        std::greater<std::pair<double, int>>> pq;
+    size_t pushes = 0;
+    size_t pops = 0;
+    size_t stalePops = 0;
+    size_t peakSize = 0;
     
-    key[0] = 0.0;
-    pq.push({0.0, 0});
+    if (V > 0) {
+        key[0] = 0.0;
+        pq.push({0.0, 0});
+        pushes++;
+    }
     while (!pq.empty()) {
+        peakSize = std::max(peakSize, pq.size());
         int u = pq.top().second;
         pq.pop();
-        if (inMST[u]) continue;
+        pops++;
+        if (inMST[u]) {
+            stalePops++;
+            continue;
+        }
         inMST[u] = true;
         if (parent[u] != -1) {
             result.edges.push_back({parent[u], u, key[u]});
             result.totalWeight += key[u];
         }
         
-        for (const auto& neighbor : adjList[u]) {
-            int v = neighbor.first;
-            double weight = neighbor.second;
+        forEachNeighbor(u, [&](int v, double weight) {
             if (!inMST[v] && weight < key[v]) {
                 key[v] = weight;
                 parent[v] = u;
                 pq.push({key[v], v});
+                pushes++;
             }
+        });
+    }
+
+    result.metrics["heap_pushes"] = static_cast<double>(pushes);
+    result.metrics["heap_pops"] = static_cast<double>(pops);
+    result.metrics["heap_stale_pops"] = static_cast<double>(stalePops);
+    result.metrics["heap_peak_size"] = static_cast<double>(peakSize);
+}
+
+template <typename ForEachNeighbor>
+void Prim::buildTreeIndexed(int V, ForEachNeighbor forEachNeighbor, MSTResult& result) {
+    std::vector<bool> inMST(V, false);
+    std::vector<int> parent(V, -1);
+    IndexedDaryHeap<double, HEAP_ARITY> pq(V);
+
+    if (V > 0) {
+        pq.push(0, 0.0);
+    }
+    while (!pq.empty()) {
+        double weight = pq.key(pq.top());
+        int u = pq.pop();
+        inMST[u] = true;
+        if (parent[u] != -1) {
+            result.edges.push_back({parent[u], u, weight});
+            result.totalWeight += weight;
         }
+
+        forEachNeighbor(u, [&](int v, double w) {
+            if (inMST[v]) return;
+            if (!pq.contains(v)) {
+                parent[v] = u;
+                pq.push(v, w);
+            } else if (w < pq.key(v)) {
+                parent[v] = u;
+                pq.decreaseKey(v, w);
+            }
+        });
     }
-    
-    timer.stop();
-    result.executionTime = timer.elapsedMilliseconds();
-    result.memoryUsage = MemoryMonitor::getCurrentMemoryUsage() - initialMemory;
-    return result;
+
+    result.metrics["heap_pushes"] = static_cast<double>(pq.getPushCount());
+    result.metrics["heap_pops"] = static_cast<double>(pq.getPopCount());
+    result.metrics["heap_decrease_keys"] = static_cast<double>(pq.getDecreaseCount());
+    result.metrics["heap_peak_size"] = static_cast<double>(pq.getPeakSize());
 }
\ No newline at end of file
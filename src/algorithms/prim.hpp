@@ -4,14 +4,40 @@
 #include "mst_algorithm.hpp"
 #include <string>
 
+enum class PrimHeap {
+    Lazy,     // std::priority_queue, one entry per key improvement
+    Indexed   // IndexedDaryHeap with decreaseKey, at most V entries
+};
+
 class Prim : public MSTAlgorithm {
 public:
-    Prim() = default;
+    static constexpr int HEAP_ARITY = 4;
+    // Graphs with E / V^2 above this go to PrimDense when the matrix fits.
+    static constexpr double DEFAULT_DENSE_THRESHOLD = 0.25;
+
+    Prim(PrimHeap heapKind = PrimHeap::Lazy, double denseThreshold = DEFAULT_DENSE_THRESHOLD)
+        : heap(heapKind), denseThreshold(denseThreshold) {}
     
     MSTResult solve(const Graph& graph) override;
+    MSTResult solve(const CSRGraph& graph) override;
     std::string getName() const override { 
-        return "Prim_BinaryHeap"; 
+        return heap == PrimHeap::Lazy ? "Prim_BinaryHeap" : "Prim_IndexedHeap"; 
     }
+
+private:
+    PrimHeap heap;
+    double denseThreshold;
+
+    bool useDense(int V, size_t E) const;
+    template <typename GraphT>
+    MSTResult solveDense(const GraphT& graph) const;
+
+    template <typename ForEachNeighbor>
+    void buildTree(int V, ForEachNeighbor forEachNeighbor, MSTResult& result);
+    template <typename ForEachNeighbor>
+    void buildTreeLazy(int V, ForEachNeighbor forEachNeighbor, MSTResult& result);
+    template <typename ForEachNeighbor>
+    void buildTreeIndexed(int V, ForEachNeighbor forEachNeighbor, MSTResult& result);
 };
 
 #endif
\ No newline at end of file
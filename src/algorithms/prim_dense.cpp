@@ -0,0 +1,229 @@
+#include "prim_dense.hpp"
+#include "../utils/timer.hpp"
+#include "../utils/allocation_tracker.hpp"
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PRIM_DENSE_X86 1
+#endif
+
+namespace {
+
+const double INF = std::numeric_limits<double>::infinity();
+
+// Relaxes key[v] = min(key[v], row[v] + blocked[v]) for v in [begin, V), records
+// u as the parent of improved vertices and returns the first minimum of the
+// updated keys together with its value.
+inline void relaxScalar(const double* row, double* key, const double* blocked, int64_t* parent,
+                        int u, int begin, int V, double& bestKey, int& best) {
+    for (int v = begin; v < V; ++v) {
+        double w = row[v] + blocked[v];
+        if (w < key[v]) {
+            key[v] = w;
+            parent[v] = u;
+        }
+        if (key[v] < bestKey) {
+            bestKey = key[v];
+            best = v;
+        }
+    }
+}
+
+int relaxRowScalar(const double* row, double* key, const double* blocked, int64_t* parent, int u, int V) {
+    double bestKey = INF;
+    int best = -1;
+    relaxScalar(row, key, blocked, parent, u, 0, V, bestKey, best);
+    return best;
+}
+
+#ifdef PRIM_DENSE_X86
+int relaxRowSSE2(const double* row, double* key, const double* blocked, int64_t* parent, int u, int V) {
+    const __m128d step = _mm_set1_pd(2.0);
+    const __m128i parentU = _mm_set1_epi64x(u);
+    __m128d index = _mm_setr_pd(0.0, 1.0);
+    __m128d bestKeys = _mm_set1_pd(INF);
+    __m128d bestIndex = _mm_set1_pd(-1.0);
+    int v = 0;
+    for (; v + 2 <= V; v += 2) {
+        __m128d w = _mm_add_pd(_mm_loadu_pd(row + v), _mm_loadu_pd(blocked + v));
+        __m128d k = _mm_loadu_pd(key + v);
+        __m128d improved = _mm_cmplt_pd(w, k);
+        k = _mm_min_pd(w, k);
+        _mm_storeu_pd(key + v, k);
+        __m128i mask = _mm_castpd_si128(improved);
+        __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(parent + v));
+        p = _mm_or_si128(_mm_and_si128(mask, parentU), _mm_andnot_si128(mask, p));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(parent + v), p);
+
+        __m128d better = _mm_cmplt_pd(k, bestKeys);
+        bestKeys = _mm_or_pd(_mm_and_pd(better, k), _mm_andnot_pd(better, bestKeys));
+        bestIndex = _mm_or_pd(_mm_and_pd(better, index), _mm_andnot_pd(better, bestIndex));
+        index = _mm_add_pd(index, step);
+    }
+
+    alignas(16) double keys[2];
+    alignas(16) double indices[2];
+    _mm_store_pd(keys, bestKeys);
+    _mm_store_pd(indices, bestIndex);
+    double bestKey = INF;
+    int best = -1;
+    for (int lane = 0; lane < 2; ++lane) {
+        int candidate = static_cast<int>(indices[lane]);
+        if (keys[lane] < bestKey || (keys[lane] == bestKey && candidate >= 0 && candidate < best)) {
+            bestKey = keys[lane];
+            best = candidate;
+        }
+    }
+    relaxScalar(row, key, blocked, parent, u, v, V, bestKey, best);
+    return best;
+}
+
+__attribute__((target("avx2")))
+int relaxRowAVX2(const double* row, double* key, const double* blocked, int64_t* parent, int u, int V) {
+    const __m256d step = _mm256_set1_pd(4.0);
+    const __m256d parentU = _mm256_castsi256_pd(_mm256_set1_epi64x(u));
+    __m256d index = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+    __m256d bestKeys = _mm256_set1_pd(INF);
+    __m256d bestIndex = _mm256_set1_pd(-1.0);
+    int v = 0;
+    for (; v + 4 <= V; v += 4) {
+        __m256d w = _mm256_add_pd(_mm256_loadu_pd(row + v), _mm256_loadu_pd(blocked + v));
+        __m256d k = _mm256_loadu_pd(key + v);
+        __m256d improved = _mm256_cmp_pd(w, k, _CMP_LT_OQ);
+        k = _mm256_min_pd(w, k);
+        _mm256_storeu_pd(key + v, k);
+        double* parentSlot = reinterpret_cast<double*>(parent + v);
+        _mm256_storeu_pd(parentSlot, _mm256_blendv_pd(_mm256_loadu_pd(parentSlot), parentU, improved));
+
+        __m256d better = _mm256_cmp_pd(k, bestKeys, _CMP_LT_OQ);
+        bestKeys = _mm256_blendv_pd(bestKeys, k, better);
+        bestIndex = _mm256_blendv_pd(bestIndex, index, better);
+        index = _mm256_add_pd(index, step);
+    }
+
+    alignas(32) double keys[4];
+    alignas(32) double indices[4];
+    _mm256_store_pd(keys, bestKeys);
+    _mm256_store_pd(indices, bestIndex);
+    double bestKey = INF;
+    int best = -1;
+    for (int lane = 0; lane < 4; ++lane) {
+        int candidate = static_cast<int>(indices[lane]);
+        if (keys[lane] < bestKey || (keys[lane] == bestKey && candidate >= 0 && candidate < best)) {
+            bestKey = keys[lane];
+            best = candidate;
+        }
+    }
+    relaxScalar(row, key, blocked, parent, u, v, V, bestKey, best);
+    return best;
+}
+#endif
+
+}
+
+SimdLevel PrimDense::detectSimdLevel() {
+#ifdef PRIM_DENSE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2")) return SimdLevel::SSE2;
+#endif
+    return SimdLevel::Scalar;
+}
+
+std::string PrimDense::simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SSE2: return "SSE2";
+        default: return "Scalar";
+    }
+}
+
+bool PrimDense::fitsInMemory(int vertices) {
+    return static_cast<size_t>(vertices) * vertices * sizeof(double) <= MAX_MATRIX_BYTES;
+}
+
+MSTResult PrimDense::solve(const Graph& graph) {
+    MSTResult result;
+    result.algorithmName = getName();
+    Timer timer;
+    timer.start();
+    AllocationTracker::Scope allocations;
+    int V = graph.getVertices();
+    if (!fitsInMemory(V)) {
+        throw std::length_error("PrimDense: weight matrix exceeds memory limit");
+    }
+
+    std::vector<double> matrix(static_cast<size_t>(V) * V, INF);
+    const auto& adjList = graph.getAdjList();
+    for (int u = 0; u < V; ++u) {
+        double* row = matrix.data() + static_cast<size_t>(u) * V;
+        for (const auto& neighbor : adjList[u]) {
+            row[neighbor.first] = std::min(row[neighbor.first], neighbor.second);
+        }
+    }
+    result.metrics["matrix_ms"] = timer.elapsedMilliseconds();
+    buildTree(V, matrix.data(), result);
+
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+MSTResult PrimDense::solve(const CSRGraph& graph) {
+    MSTResult result;
+    result.algorithmName = getName();
+    Timer timer;
+    timer.start();
+    AllocationTracker::Scope allocations;
+    int V = graph.getVertices();
+    if (!fitsInMemory(V)) {
+        throw std::length_error("PrimDense: weight matrix exceeds memory limit");
+    }
+
+    std::vector<double> matrix(static_cast<size_t>(V) * V, INF);
+    const int* targets = graph.getTargets();
+    const double* weights = graph.getWeights();
+    for (int u = 0; u < V; ++u) {
+        double* row = matrix.data() + static_cast<size_t>(u) * V;
+        for (size_t k = graph.rowBegin(u); k < graph.rowEnd(u); ++k) {
+            row[targets[k]] = std::min(row[targets[k]], weights[k]);
+        }
+    }
+    result.metrics["matrix_ms"] = timer.elapsedMilliseconds();
+    buildTree(V, matrix.data(), result);
+
+    timer.stop();
+    result.executionTime = timer.elapsedMilliseconds();
+    result.recordAllocations(allocations.stop());
+    return result;
+}
+
+void PrimDense::buildTree(int V, const double* matrix, MSTResult& result) const {
+    if (V == 0) return;
+    auto relaxRow = relaxRowScalar;
+#ifdef PRIM_DENSE_X86
+    if (simd == SimdLevel::AVX2) relaxRow = relaxRowAVX2;
+    if (simd == SimdLevel::SSE2) relaxRow = relaxRowSSE2;
+#endif
+
+    std::vector<double> key(V, INF);
+    std::vector<double> blocked(V, 0.0);
+    std::vector<int64_t> parent(V, -1);
+    int u = 0;
+    key[0] = 0.0;
+    while (u >= 0) {
+        if (parent[u] != -1) {
+            result.edges.push_back({static_cast<int>(parent[u]), u, key[u]});
+            result.totalWeight += key[u];
+        }
+        key[u] = INF;
+        blocked[u] = INF;
+        u = relaxRow(matrix + static_cast<size_t>(u) * V, key.data(), blocked.data(), parent.data(), u, V);
+    }
+}
\ No newline at end of file
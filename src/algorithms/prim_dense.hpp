@@ -0,0 +1,38 @@
+#ifndef PRIM_DENSE_HPP
+#define PRIM_DENSE_HPP
+
+#include "mst_algorithm.hpp"
+#include <string>
+#include <cstddef>
+
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2
+};
+
+// O(V^2) Prim over a row-major weight matrix (+inf where there is no edge).
+// Each step relaxes one matrix row into the key array and finds the next
+// vertex in the same vectorized pass; tree vertices are masked out by adding
+// +inf, so the kernel has no per-element branches.
+class PrimDense : public MSTAlgorithm {
+public:
+    static constexpr size_t MAX_MATRIX_BYTES = size_t(512) << 20;
+
+    PrimDense(SimdLevel level = detectSimdLevel()) : simd(level) {}
+
+    MSTResult solve(const Graph& graph) override;
+    MSTResult solve(const CSRGraph& graph) override;
+    std::string getName() const override { return "PrimDense_" + simdLevelName(simd); }
+
+    static SimdLevel detectSimdLevel();
+    static std::string simdLevelName(SimdLevel level);
+    static bool fitsInMemory(int vertices);
+
+private:
+    SimdLevel simd;
+
+    void buildTree(int V, const double* matrix, MSTResult& result) const;
+};
+
+#endif
\ No newline at end of file
@@ -1,9 +1,16 @@
 #include "verifier.hpp"
+#include "edge_sort.hpp"
+#include "../data_structures/forest_path_max.hpp"
+#include "../data_structures/concurrent_union_find.hpp"
+#include "../data_structures/union_find.hpp"
+#include "../utils/thread_pool.hpp"
+#include "../utils/timer.hpp"
 #include <vector>
-#include <queue>
+#include <utility>
 #include <algorithm>
-#include <iostream>
-#include <functional>
+#include <atomic>
+#include <sstream>
+#include <cstdint>
 
 std::unordered_set<int> MSTVerifier::findHeavyEdges(
     const std::vector<std::tuple<int, int, double, int>>& graph,
@@ -15,105 +22,166 @@ std::unordered_set<int> MSTVerifier::findHeavyEdges(
     if (forest.empty()) {
         return heavy_edges;
     }
-    
-    std::vector<std::vector<std::pair<int, double>>> adj(numVertices);
-    buildTreeAdjacency(forest, numVertices, adj);
-    
-    for (const auto& edge : graph) {
+
+    std::vector<std::tuple<int, int, double, int>> validForest;
+    validForest.reserve(forest.size());
+    for (const auto& edge : forest) {
         int u = std::get<0>(edge);
         int v = std::get<1>(edge);
-        double weight = std::get<2>(edge);
-        int id = std::get<3>(edge);
+        if (u >= 0 && u < numVertices && v >= 0 && v < numVertices && u != v) {
+            validForest.push_back(edge);
+        }
+    }
+    
+    std::vector<std::pair<int, int>> queries;
+    std::vector<size_t> queryEdge;
+    queries.reserve(graph.size());
+    queryEdge.reserve(graph.size());
+    for (size_t i = 0; i < graph.size(); ++i) {
+        int u = std::get<0>(graph[i]);
+        int v = std::get<1>(graph[i]);
         if (u == v || u >= numVertices || v >= numVertices || u < 0 || v < 0) {
             continue;
         }
-        if (!areConnectedInForest(u, v, adj)) {
-            continue;
+        queries.emplace_back(u, v);
+        queryEdge.push_back(i);
+    }
+
+    std::vector<double> pathMax = ForestPathMax::query(numVertices, validForest, queries);
+    for (size_t k = 0; k < queries.size(); ++k) {
+        const auto& edge = graph[queryEdge[k]];
+        if (std::get<2>(edge) > pathMax[k] + EPSILON) {
+            heavy_edges.insert(std::get<3>(edge));
+        }
+    }
+    
+    return heavy_edges;
+}
+
+VerificationReport MSTVerifier::verify(const Graph& graph, const MSTResult& result, int numThreads) {
+    Timer timer;
+    timer.start();
+    VerificationReport report = verifyEdges(graph.getVertices(), graph.getEdgeListWithIds(), result, numThreads);
+    report.milliseconds = timer.elapsedMilliseconds();
+    return report;
+}
+
+VerificationReport MSTVerifier::verify(const CSRGraph& graph, const MSTResult& result, int numThreads) {
+    Timer timer;
+    timer.start();
+    VerificationReport report = verifyEdges(graph.getVertices(), graph.getEdgeListWithIds(), result, numThreads);
+    report.milliseconds = timer.elapsedMilliseconds();
+    return report;
+}
+
+VerificationReport MSTVerifier::verifyEdges(int numVertices,
+                                            const std::vector<std::tuple<int, int, double, int>>& graph,
+                                            const MSTResult& result, int numThreads) {
+    VerificationReport report;
+    ThreadPool pool(std::max(1, numThreads));
+    const size_t m = graph.size();
+    const size_t k = result.edges.size();
+    report.treeEdges = k;
+
+    ConcurrentUnionFind components(numVertices);
+    pool.parallelFor(m, [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            components.unite(std::get<0>(graph[i]), std::get<1>(graph[i]));
+        }
+    });
+    report.expectedTreeEdges = static_cast<size_t>(numVertices - components.getComponents());
+
+    // Group parallel edges by endpoint pair so each result edge is matched
+    // against the graph with one binary search.
+    auto pairKey = [numVertices](int u, int v) {
+        if (u > v) std::swap(u, v);
+        return static_cast<uint64_t>(u) * static_cast<uint64_t>(numVertices) + static_cast<uint64_t>(v);
+    };
+    std::vector<uint64_t> keys(m);
+    std::vector<uint32_t> order(m);
+    pool.parallelFor(m, [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            keys[i] = pairKey(std::get<0>(graph[i]), std::get<1>(graph[i]));
+            order[i] = static_cast<uint32_t>(i);
         }
-        std::vector<double> max_weight(numVertices, 0.0);
-        std::vector<bool> visited(numVertices, false);
-        std::queue<int> q;
-        
-        q.push(u);
-        visited[u] = true;
-        max_weight[u] = 0.0;
-        
-        bool found = false;
-        while (!q.empty() && !found) {
-            int current = q.front();
-            q.pop();
-            
-            for (const auto& neighbor : adj[current]) {
-                int next = neighbor.first;
-                double edge_weight = neighbor.second;
-                
-                if (!visited[next]) {
-                    visited[next] = true;
-                    max_weight[next] = std::max(max_weight[current], edge_weight);
-                    
-                    if (next == v) {
+    });
+    EdgeSorter::radixSort(keys, order, pool.size(), &pool);
+
+    std::vector<int> treeU(k);
+    std::vector<int> treeV(k);
+    std::vector<double> treeWeight(k);
+    std::atomic<size_t> unknown{0};
+    pool.parallelFor(k, [&](int, size_t begin, size_t end) {
+        size_t missing = 0;
+        for (size_t i = begin; i < end; ++i) {
+            const auto& [u, v, weight] = result.edges[i];
+            treeU[i] = u;
+            treeV[i] = v;
+            treeWeight[i] = weight;
+            bool found = false;
+            if (u >= 0 && u < numVertices && v >= 0 && v < numVertices && u != v) {
+                uint64_t key = pairKey(u, v);
+                for (auto it = std::lower_bound(keys.begin(), keys.end(), key); it != keys.end() && *it == key; ++it) {
+                    if (std::fabs(std::get<2>(graph[order[it - keys.begin()]]) - weight) <= EPSILON) {
                         found = true;
                         break;
                     }
-                    q.push(next);
                 }
             }
+            if (!found) missing++;
         }
-        
-        if (found && weight > max_weight[v] + EPSILON) {
-            heavy_edges.insert(id);
+        unknown.fetch_add(missing, std::memory_order_relaxed);
+    });
+    report.unknownEdges = unknown.load();
+
+    std::ostringstream problems;
+    if (report.unknownEdges > 0) {
+        problems << report.unknownEdges << " result edges are not graph edges; ";
+    } else {
+        UnionFind<> forest(numVertices);
+        report.acyclic = true;
+        for (size_t i = 0; i < k && report.acyclic; ++i) {
+            report.acyclic = forest.unite(treeU[i], treeV[i]);
         }
+        if (!report.acyclic) problems << "result contains a cycle; ";
+    }
+    report.spanning = report.acyclic && k == report.expectedTreeEdges;
+    if (report.acyclic && !report.spanning) {
+        problems << "result has " << k << " edges, a spanning forest needs " << report.expectedTreeEdges << "; ";
     }
-    
-    return heavy_edges;
-}
 
-void MSTVerifier::buildTreeAdjacency(
-    const std::vector<std::tuple<int, int, double, int>>& forest,
-    int numVertices,
-    std::vector<std::vector<std::pair<int, double>>>& adj) {
-    
-    adj.clear();
-    adj.resize(numVertices);
-    
-    for (const auto& edge : forest) {
-        int u = std::get<0>(edge);
-        int v = std::get<1>(edge);
-        double weight = std::get<2>(edge);
-        if (u >= 0 && u < numVertices && v >= 0 && v < numVertices && u != v) {
-            adj[u].emplace_back(v, weight);
-            adj[v].emplace_back(u, weight);
-        }
+    double sum = 0.0;
+    for (double weight : treeWeight) sum += weight;
+    report.weightMatches = std::fabs(sum - result.totalWeight) <= 1e-6 * std::max(1.0, std::fabs(sum));
+    if (!report.weightMatches) {
+        problems << "totalWeight " << result.totalWeight << " differs from edge sum " << sum << "; ";
     }
-}
 
-bool MSTVerifier::areConnectedInForest(
-    int u, int v, 
-    const std::vector<std::vector<std::pair<int, double>>>& adj) {
-    
-    if (u == v) return true;
-    if (u >= adj.size() || v >= adj.size() || u < 0 || v < 0) return false;
-    
-    std::vector<bool> visited(adj.size(), false);
-    std::queue<int> q;
-    
-    q.push(u);
-    visited[u] = true;
-    
-    while (!q.empty()) {
-        int current = q.front();
-        q.pop();
-        
-        if (current == v) return true;
-        
-        for (const auto& neighbor : adj[current]) {
-            int next = neighbor.first;
-            if (!visited[next]) {
-                visited[next] = true;
-                q.push(next);
+    if (report.acyclic) {
+        LiftedForest lifted(numVertices, k, treeU.data(), treeV.data(), treeWeight.data(), &pool);
+        std::atomic<size_t> lighter{0};
+        pool.parallelFor(m, [&](int, size_t begin, size_t end) {
+            size_t count = 0;
+            for (size_t i = begin; i < end; ++i) {
+                int u = std::get<0>(graph[i]);
+                int v = std::get<1>(graph[i]);
+                if (u == v || !lifted.connected(u, v)) continue;
+                if (std::get<2>(graph[i]) + EPSILON < lifted.pathMax(u, v)) count++;
             }
+            lighter.fetch_add(count, std::memory_order_relaxed);
+        });
+        report.lighterEdges = lighter.load();
+        report.minimal = report.lighterEdges == 0;
+        if (!report.minimal) {
+            problems << report.lighterEdges << " graph edges are lighter than the tree path they close; ";
         }
     }
-    
-    return false;
+
+    report.message = problems.str();
+    if (report.message.empty()) {
+        report.message = "ok";
+    } else {
+        report.message.resize(report.message.size() - 2);
+    }
+    return report;
 }
\ No newline at end of file
@@ -1,11 +1,15 @@
 #ifndef VERIFIER_HPP
 #define VERIFIER_HPP
 
+#include "mst_algorithm.hpp"
+#include "../utils/parallel.hpp"
 #include <vector>
 #include <tuple>
+#include <string>
 #include <unordered_set>
 #include <functional>
 #include <cmath>
+#include <cstddef>
 
 const double EPSILON = 1e-9;
 
@@ -18,22 +22,51 @@ struct pair_hash {
     }
 };
 
+struct VerificationReport {
+    bool spanning;
+    bool acyclic;
+    bool minimal;
+    bool weightMatches;
+    size_t treeEdges;
+    size_t expectedTreeEdges;
+    // Result edges that are not graph edges (wrong endpoints or weight).
+    size_t unknownEdges;
+    // Graph edges lighter than the heaviest tree edge on the path they close.
+    size_t lighterEdges;
+    double milliseconds;
+    std::string message;
+
+    VerificationReport()
+        : spanning(false), acyclic(false), minimal(false), weightMatches(false), treeEdges(0),
+          expectedTreeEdges(0), unknownEdges(0), lighterEdges(0), milliseconds(0.0) {}
+
+    bool valid() const { return spanning && acyclic && minimal && weightMatches; }
+};
+
 class MSTVerifier {
+private:
+    static VerificationReport verifyEdges(int numVertices,
+                                          const std::vector<std::tuple<int, int, double, int>>& graph,
+                                          const MSTResult& result, int numThreads);
+
 public:
+    // Checks that result is a minimum spanning forest of graph: every result
+    // edge is a graph edge, the edges are acyclic and span each component,
+    // totalWeight matches, and no graph edge is lighter than the path maximum
+    // of the tree cycle it closes (the cycle property). Path maxima come from
+    // a LiftedForest and are queried in parallel, so the check is
+    // O(E log V / threads); milliseconds reports its own cost.
+    static VerificationReport verify(const Graph& graph, const MSTResult& result,
+                                     int numThreads = defaultThreadCount());
+    static VerificationReport verify(const CSRGraph& graph, const MSTResult& result,
+                                     int numThreads = defaultThreadCount());
+
+    // Ids of the graph edges that are F-heavy: heavier than every edge on the
+    // forest path between their endpoints. Answered offline by ForestPathMax.
     static std::unordered_set<int> findHeavyEdges(
         const std::vector<std::tuple<int, int, double, int>>& graph,
         const std::vector<std::tuple<int, int, double, int>>& forest,
         int numVertices);
-    
-private:
-    static void buildTreeAdjacency(
-        const std::vector<std::tuple<int, int, double, int>>& forest,
-        int numVertices,
-        std::vector<std::vector<std::pair<int, double>>>& adj);
-    
-    static bool areConnectedInForest(
-        int u, int v, 
-        const std::vector<std::vector<std::pair<int, double>>>& adj);
 };
 
 #endif
\ No newline at end of file
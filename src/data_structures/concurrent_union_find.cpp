@@ -0,0 +1,55 @@
+#include "concurrent_union_find.hpp"
+#include <utility>
+
+ConcurrentUnionFind::ConcurrentUnionFind(int n) : parent(n), components(n) {
+    for (int i = 0; i < n; ++i) {
+        parent[i].store(i, std::memory_order_relaxed);
+    }
+}
+
+int ConcurrentUnionFind::find(int x) {
+    while (true) {
+        int p = parent[x].load(std::memory_order_acquire);
+        if (p == x) {
+            return x;
+        }
+        int grandparent = parent[p].load(std::memory_order_acquire);
+        if (p != grandparent) {
+            parent[x].compare_exchange_weak(p, grandparent, std::memory_order_release,
+                                            std::memory_order_relaxed);
+        }
+        x = grandparent;
+    }
+}
+
+bool ConcurrentUnionFind::unite(int x, int y) {
+    while (true) {
+        x = find(x);
+        y = find(y);
+        if (x == y) {
+            return false;
+        }
+        if (x > y) {
+            std::swap(x, y);
+        }
+        int expected = x;
+        if (parent[x].compare_exchange_strong(expected, y, std::memory_order_acq_rel,
+                                              std::memory_order_acquire)) {
+            components.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+bool ConcurrentUnionFind::connected(int x, int y) {
+    while (true) {
+        x = find(x);
+        y = find(y);
+        if (x == y) {
+            return true;
+        }
+        if (parent[x].load(std::memory_order_acquire) == x) {
+            return false;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#ifndef CONCURRENT_UNION_FIND_HPP
+#define CONCURRENT_UNION_FIND_HPP
+
+#include <vector>
+#include <atomic>
+
+// Lock-free disjoint sets safe to share between threads. find uses path halving
+// with a single CAS attempt per step (it never retries), and unite links the
+// smaller-index root under the larger one with CAS, retrying only when another
+// thread changed one of the roots first.
+class ConcurrentUnionFind {
+private:
+    std::vector<std::atomic<int>> parent;
+    std::atomic<int> components;
+
+public:
+    explicit ConcurrentUnionFind(int n);
+
+    int find(int x);
+    // Returns true if this call merged two different sets.
+    bool unite(int x, int y);
+    bool connected(int x, int y);
+    int getComponents() const { return components.load(std::memory_order_relaxed); }
+    int size() const { return static_cast<int>(parent.size()); }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,120 @@
+#include "csr_graph.hpp"
+#include <queue>
+#include <utility>
+
+namespace {
+struct OwnedArrays {
+    std::vector<size_t> offsets;
+    std::vector<int> targets;
+    std::vector<double> weights;
+    std::vector<int> edgeIds;
+};
+}
+
+CSRGraph::CSRGraph() : V(0), E(0), mapped(false) {
+    adopt(std::vector<size_t>(1, 0), {}, {}, {});
+}
+
+CSRGraph::CSRGraph(const Graph& graph) : V(graph.getVertices()), E(graph.getEdges()), mapped(false) {
+    const auto& edges = graph.getEdgeListWithIds();
+    std::vector<size_t> rowOffsets(V + 1, 0);
+    for (const auto& edge : edges) {
+        rowOffsets[std::get<0>(edge) + 1]++;
+        rowOffsets[std::get<1>(edge) + 1]++;
+    }
+    for (int u = 0; u < V; ++u) {
+        rowOffsets[u + 1] += rowOffsets[u];
+    }
+
+    size_t entries = rowOffsets[V];
+    std::vector<int> rowTargets(entries);
+    std::vector<double> rowWeights(entries);
+    std::vector<int> rowEdgeIds(entries);
+    std::vector<size_t> cursor(rowOffsets.begin(), rowOffsets.end() - 1);
+    for (const auto& edge : edges) {
+        int u = std::get<0>(edge);
+        int v = std::get<1>(edge);
+        double weight = std::get<2>(edge);
+        int id = std::get<3>(edge);
+
+        size_t k = cursor[u]++;
+        rowTargets[k] = v;
+        rowWeights[k] = weight;
+        rowEdgeIds[k] = id;
+
+        k = cursor[v]++;
+        rowTargets[k] = u;
+        rowWeights[k] = weight;
+        rowEdgeIds[k] = id;
+    }
+    adopt(std::move(rowOffsets), std::move(rowTargets), std::move(rowWeights), std::move(rowEdgeIds));
+}
+
+CSRGraph::CSRGraph(int vertices, size_t edges, std::vector<size_t> rowOffsets, std::vector<int> rowTargets,
+                   std::vector<double> rowWeights, std::vector<int> rowEdgeIds)
+    : V(vertices), E(edges), mapped(false) {
+    adopt(std::move(rowOffsets), std::move(rowTargets), std::move(rowWeights), std::move(rowEdgeIds));
+}
+
+CSRGraph::CSRGraph(int vertices, size_t edges, const size_t* rowOffsets, const int* rowTargets,
+                   const double* rowWeights, const int* rowEdgeIds, std::shared_ptr<const void> owner)
+    : V(vertices), E(edges), offsets(rowOffsets), targets(rowTargets), weights(rowWeights),
+      edgeIds(rowEdgeIds), storage(std::move(owner)), mapped(true) {}
+
+void CSRGraph::adopt(std::vector<size_t> rowOffsets, std::vector<int> rowTargets,
+                     std::vector<double> rowWeights, std::vector<int> rowEdgeIds) {
+    auto arrays = std::make_shared<OwnedArrays>();
+    arrays->offsets = std::move(rowOffsets);
+    arrays->targets = std::move(rowTargets);
+    arrays->weights = std::move(rowWeights);
+    arrays->edgeIds = std::move(rowEdgeIds);
+    offsets = arrays->offsets.data();
+    targets = arrays->targets.data();
+    weights = arrays->weights.data();
+    edgeIds = arrays->edgeIds.data();
+    storage = std::move(arrays);
+}
+
+std::vector<std::tuple<int, int, double, int>> CSRGraph::getEdgeListWithIds() const {
+    std::vector<std::tuple<int, int, double, int>> edges;
+    edges.reserve(E);
+    for (int u = 0; u < V; ++u) {
+        for (size_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+            if (targets[k] > u) {
+                edges.emplace_back(u, targets[k], weights[k], edgeIds[k]);
+            }
+        }
+    }
+    return edges;
+}
+
+bool CSRGraph::isConnected() const {
+    if (V == 0) return true;
+
+    std::vector<bool> visited(V, false);
+    std::queue<int> q;
+    int visitedCount = 0;
+    q.push(0);
+    visited[0] = true;
+    while (!q.empty()) {
+        int u = q.front();
+        q.pop();
+        visitedCount++;
+        for (size_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+            int v = targets[k];
+            if (!visited[v]) {
+                visited[v] = true;
+                q.push(v);
+            }
+        }
+    }
+
+    return visitedCount == V;
+}
+
+size_t CSRGraph::memoryBytes() const {
+    size_t entries = getEntries();
+    return sizeof(*this) +
+           (static_cast<size_t>(V) + 1) * sizeof(size_t) +
+           entries * (sizeof(int) + sizeof(double) + sizeof(int));
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#ifndef CSR_GRAPH_HPP
+#define CSR_GRAPH_HPP
+
+#include "graph.hpp"
+#include <vector>
+#include <tuple>
+#include <memory>
+#include <cstddef>
+
+// Frozen compressed-sparse-row view of an undirected graph. Every edge is
+// stored once in the row of each endpoint; the entries of row u live in
+// [rowBegin(u), rowEnd(u)) of the targets/weights/edgeIds arrays.
+// The arrays are immutable and either owned by the graph or borrowed from a
+// memory-mapped file; copies share the same storage.
+class CSRGraph {
+private:
+    int V;
+    size_t E;
+    const size_t* offsets;
+    const int* targets;
+    const double* weights;
+    const int* edgeIds;
+    std::shared_ptr<const void> storage;
+    bool mapped;
+
+    void adopt(std::vector<size_t> rowOffsets, std::vector<int> rowTargets,
+               std::vector<double> rowWeights, std::vector<int> rowEdgeIds);
+
+public:
+    CSRGraph();
+    explicit CSRGraph(const Graph& graph);
+    CSRGraph(int vertices, size_t edges, std::vector<size_t> rowOffsets, std::vector<int> rowTargets,
+             std::vector<double> rowWeights, std::vector<int> rowEdgeIds);
+    // Borrows external arrays; owner keeps them alive for the lifetime of every copy.
+    CSRGraph(int vertices, size_t edges, const size_t* rowOffsets, const int* rowTargets,
+             const double* rowWeights, const int* rowEdgeIds, std::shared_ptr<const void> owner);
+
+    int getVertices() const { return V; }
+    size_t getEdges() const { return E; }
+    size_t getEntries() const { return offsets[V]; }
+    size_t rowBegin(int u) const { return offsets[u]; }
+    size_t rowEnd(int u) const { return offsets[u + 1]; }
+    int degree(int u) const { return static_cast<int>(offsets[u + 1] - offsets[u]); }
+    bool isMapped() const { return mapped; }
+
+    const size_t* getOffsets() const { return offsets; }
+    const int* getTargets() const { return targets; }
+    const double* getWeights() const { return weights; }
+    const int* getEdgeIds() const { return edgeIds; }
+
+    // Each undirected edge once as (u, v, weight, id) with u < v; self-loops are dropped.
+    std::vector<std::tuple<int, int, double, int>> getEdgeListWithIds() const;
+    bool isConnected() const;
+    // Bytes held by the CSR arrays, whether on the heap or in a mapping.
+    size_t memoryBytes() const;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,263 @@
+#include "forest_path_max.hpp"
+#include <limits>
+#include <algorithm>
+#include <cstddef>
+
+namespace {
+const double INF = std::numeric_limits<double>::infinity();
+
+// Union-find over finished subtrees; up[x] is the maximum weight on the tree
+// path from x to parent[x], so compression folds maxima along the way.
+class WeightedLinks {
+private:
+    std::pmr::vector<int> parent;
+    std::pmr::vector<double> up;
+    std::pmr::vector<int> path;
+
+public:
+    WeightedLinks(int n, std::pmr::memory_resource* resource)
+        : parent(n, resource), up(n, -INF, resource), path(resource) {
+        for (int i = 0; i < n; ++i) parent[i] = i;
+    }
+
+    void link(int child, int target, double weight) {
+        parent[child] = target;
+        up[child] = weight;
+    }
+
+    int find(int x) {
+        while (parent[x] != x && parent[parent[x]] != parent[x]) {
+            path.push_back(x);
+            x = parent[x];
+        }
+        int root = parent[x];
+        for (size_t i = path.size(); i-- > 0;) {
+            int node = path[i];
+            up[node] = std::max(up[node], up[parent[node]]);
+            parent[node] = root;
+        }
+        path.clear();
+        return root;
+    }
+
+    // Path maximum from x to its current root.
+    double maxToRoot(int x) {
+        find(x);
+        return parent[x] == x ? -INF : up[x];
+    }
+};
+
+using ForestEdge = std::tuple<int, int, double, int>;
+
+// Fills answers[0 .. q), which the caller sets to +infinity; scratch comes from resource.
+void answerQueries(int n, const ForestEdge* forest, size_t forestSize, const std::pair<int, int>* queries,
+                   size_t q, double* answers, std::pmr::memory_resource* resource) {
+    if (n <= 0) return;
+
+    std::pmr::vector<size_t> adjOffsets(n + 1, 0, resource);
+    for (size_t i = 0; i < forestSize; ++i) {
+        const ForestEdge& edge = forest[i];
+        adjOffsets[std::get<0>(edge) + 1]++;
+        adjOffsets[std::get<1>(edge) + 1]++;
+    }
+    for (int u = 0; u < n; ++u) adjOffsets[u + 1] += adjOffsets[u];
+    std::pmr::vector<int> adjTarget(adjOffsets[n], resource);
+    std::pmr::vector<double> adjWeight(adjOffsets[n], resource);
+    {
+        std::pmr::vector<size_t> cursor(adjOffsets.begin(), adjOffsets.end() - 1, resource);
+        for (size_t i = 0; i < forestSize; ++i) {
+            const ForestEdge& edge = forest[i];
+            int u = std::get<0>(edge);
+            int v = std::get<1>(edge);
+            double w = std::get<2>(edge);
+            adjTarget[cursor[u]] = v;
+            adjWeight[cursor[u]++] = w;
+            adjTarget[cursor[v]] = u;
+            adjWeight[cursor[v]++] = w;
+        }
+    }
+
+    std::pmr::vector<size_t> queryOffsets(n + 1, 0, resource);
+    for (size_t i = 0; i < q; ++i) {
+        queryOffsets[queries[i].first + 1]++;
+        queryOffsets[queries[i].second + 1]++;
+    }
+    for (int u = 0; u < n; ++u) queryOffsets[u + 1] += queryOffsets[u];
+    std::pmr::vector<int> queryAt(queryOffsets[n], resource);
+    {
+        std::pmr::vector<size_t> cursor(queryOffsets.begin(), queryOffsets.end() - 1, resource);
+        for (size_t i = 0; i < q; ++i) {
+            queryAt[cursor[queries[i].first]++] = static_cast<int>(i);
+            queryAt[cursor[queries[i].second]++] = static_cast<int>(i);
+        }
+    }
+
+    // Queries waiting at their LCA, as singly linked lists threaded through nextAtLca.
+    std::pmr::vector<int> lcaHead(n, -1, resource);
+    std::pmr::vector<int> nextAtLca(q, -1, resource);
+    std::pmr::vector<int> tree(n, -1, resource);
+    std::pmr::vector<char> finished(n, 0, resource);
+    std::pmr::vector<int> treeParent(n, -1, resource);
+    std::pmr::vector<double> parentWeight(n, -INF, resource);
+    std::pmr::vector<size_t> nextChild(n, resource);
+    std::pmr::vector<int> stack(resource);
+    WeightedLinks links(n, resource);
+
+    for (int root = 0; root < n; ++root) {
+        if (tree[root] != -1) continue;
+        tree[root] = root;
+        nextChild[root] = adjOffsets[root];
+        stack.push_back(root);
+        while (!stack.empty()) {
+            int u = stack.back();
+            if (nextChild[u] < adjOffsets[u + 1]) {
+                size_t k = nextChild[u]++;
+                int v = adjTarget[k];
+                if (tree[v] != -1) continue;
+                tree[v] = root;
+                treeParent[v] = u;
+                parentWeight[v] = adjWeight[k];
+                nextChild[v] = adjOffsets[v];
+                stack.push_back(v);
+                continue;
+            }
+
+            stack.pop_back();
+            for (size_t k = queryOffsets[u]; k < queryOffsets[u + 1]; ++k) {
+                int id = queryAt[k];
+                int other = queries[id].first == u ? queries[id].second : queries[id].first;
+                if (other == u) {
+                    answers[id] = -INF;
+                } else if (finished[other] && tree[other] == root) {
+                    int lca = links.find(other);
+                    nextAtLca[id] = lcaHead[lca];
+                    lcaHead[lca] = id;
+                }
+            }
+            for (int id = lcaHead[u]; id != -1; id = nextAtLca[id]) {
+                answers[id] = std::max(links.maxToRoot(queries[id].first), links.maxToRoot(queries[id].second));
+            }
+            finished[u] = 1;
+            if (treeParent[u] != -1) {
+                links.link(u, treeParent[u], parentWeight[u]);
+            }
+        }
+    }
+}
+}
+
+std::vector<double> ForestPathMax::query(
+    int numVertices,
+    const std::vector<std::tuple<int, int, double, int>>& forest,
+    const std::vector<std::pair<int, int>>& queries) {
+    std::vector<double> answers(queries.size(), INF);
+    answerQueries(numVertices, forest.data(), forest.size(), queries.data(), queries.size(), answers.data(),
+                  std::pmr::get_default_resource());
+    return answers;
+}
+
+std::pmr::vector<double> ForestPathMax::query(
+    int numVertices,
+    const std::pmr::vector<std::tuple<int, int, double, int>>& forest,
+    const std::pmr::vector<std::pair<int, int>>& queries,
+    std::pmr::memory_resource* resource) {
+    std::pmr::vector<double> answers(queries.size(), INF, resource);
+    answerQueries(numVertices, forest.data(), forest.size(), queries.data(), queries.size(), answers.data(),
+                  resource);
+    return answers;
+}
+
+LiftedForest::LiftedForest(int numVertices, size_t numEdges, const int* edgeU, const int* edgeV,
+                           const double* weights, ThreadPool* pool, std::pmr::memory_resource* resource)
+    : n(numVertices), levels(1), depth(numVertices, -1, resource), tree(numVertices, -1, resource),
+      up(resource), maxUp(resource) {
+    while ((1 << levels) < n) levels++;
+    up.resize(static_cast<size_t>(levels) * n);
+    maxUp.resize(static_cast<size_t>(levels) * n);
+
+    std::pmr::vector<size_t> offsets(n + 1, 0, resource);
+    for (size_t i = 0; i < numEdges; ++i) {
+        offsets[edgeU[i] + 1]++;
+        offsets[edgeV[i] + 1]++;
+    }
+    for (int u = 0; u < n; ++u) offsets[u + 1] += offsets[u];
+    std::pmr::vector<int> adjTarget(offsets[n], resource);
+    std::pmr::vector<double> adjWeight(offsets[n], resource);
+    {
+        std::pmr::vector<size_t> cursor(offsets.begin(), offsets.end() - 1, resource);
+        for (size_t i = 0; i < numEdges; ++i) {
+            adjTarget[cursor[edgeU[i]]] = edgeV[i];
+            adjWeight[cursor[edgeU[i]]++] = weights[i];
+            adjTarget[cursor[edgeV[i]]] = edgeU[i];
+            adjWeight[cursor[edgeV[i]]++] = weights[i];
+        }
+    }
+
+    std::pmr::vector<int> queue(n, resource);
+    for (int root = 0; root < n; ++root) {
+        if (depth[root] != -1) continue;
+        size_t head = 0;
+        size_t tail = 0;
+        queue[tail++] = root;
+        depth[root] = 0;
+        tree[root] = root;
+        up[root] = root;
+        maxUp[root] = -INF;
+        while (head < tail) {
+            int u = queue[head++];
+            for (size_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+                int v = adjTarget[k];
+                if (depth[v] != -1) continue;
+                depth[v] = depth[u] + 1;
+                tree[v] = root;
+                up[v] = u;
+                maxUp[v] = adjWeight[k];
+                queue[tail++] = v;
+            }
+        }
+    }
+
+    for (int level = 1; level < levels; ++level) {
+        const int* prevUp = up.data() + static_cast<size_t>(level - 1) * n;
+        const double* prevMax = maxUp.data() + static_cast<size_t>(level - 1) * n;
+        int* curUp = up.data() + static_cast<size_t>(level) * n;
+        double* curMax = maxUp.data() + static_cast<size_t>(level) * n;
+        auto doubleLevel = [&](int, size_t begin, size_t end) {
+            for (size_t v = begin; v < end; ++v) {
+                int mid = prevUp[v];
+                curUp[v] = prevUp[mid];
+                curMax[v] = std::max(prevMax[v], prevMax[mid]);
+            }
+        };
+        if (pool) {
+            pool->parallelFor(n, doubleLevel);
+        } else {
+            doubleLevel(0, 0, n);
+        }
+    }
+}
+
+double LiftedForest::pathMax(int a, int b) const {
+    if (tree[a] != tree[b]) return INF;
+    double best = -INF;
+    if (depth[a] < depth[b]) std::swap(a, b);
+    int lift = depth[a] - depth[b];
+    for (int level = 0; lift > 0; ++level, lift >>= 1) {
+        if (lift & 1) {
+            size_t slot = static_cast<size_t>(level) * n + a;
+            best = std::max(best, maxUp[slot]);
+            a = up[slot];
+        }
+    }
+    if (a == b) return best;
+    for (int level = levels - 1; level >= 0; --level) {
+        size_t slotA = static_cast<size_t>(level) * n + a;
+        size_t slotB = static_cast<size_t>(level) * n + b;
+        if (up[slotA] != up[slotB]) {
+            best = std::max(best, std::max(maxUp[slotA], maxUp[slotB]));
+            a = up[slotA];
+            b = up[slotB];
+        }
+    }
+    return std::max(best, std::max(maxUp[a], maxUp[b]));
+}
\ No newline at end of file
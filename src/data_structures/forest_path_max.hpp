@@ -0,0 +1,58 @@
+#ifndef FOREST_PATH_MAX_HPP
+#define FOREST_PATH_MAX_HPP
+
+#include "../utils/thread_pool.hpp"
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <memory_resource>
+#include <cstddef>
+
+// Offline maximum-edge-weight queries on the paths of a forest (Tarjan's
+// offline LCA). A DFS links every finished subtree under its parent in a
+// union-find whose links carry the maximum weight up to the link target, so a
+// find from any finished vertex yields the path maximum up to its deepest open
+// ancestor. Each query is assigned to its LCA when the second endpoint
+// finishes and answered in the LCA's post-order, when both halves of the path
+// hang off it. Runs in O((n + q) log n) worst case, near-linear in practice.
+class ForestPathMax {
+public:
+    // One answer per query: the heaviest edge on the forest path between the
+    // endpoints, +infinity if they lie in different trees, -infinity if equal.
+    static std::vector<double> query(
+        int numVertices,
+        const std::vector<std::tuple<int, int, double, int>>& forest,
+        const std::vector<std::pair<int, int>>& queries);
+
+    // Same, with the answers and every scratch array allocated from resource.
+    static std::pmr::vector<double> query(
+        int numVertices,
+        const std::pmr::vector<std::tuple<int, int, double, int>>& forest,
+        const std::pmr::vector<std::pair<int, int>>& queries,
+        std::pmr::memory_resource* resource);
+};
+
+// Online path maxima by binary lifting: each tree is rooted by BFS, then the
+// 2^k-th ancestor and the heaviest edge up to it are doubled level by level
+// (in parallel when a pool is given). pathMax is const and O(log n), so
+// callers can answer queries from many threads at once. Same conventions as
+// ForestPathMax for disconnected and equal endpoints.
+class LiftedForest {
+private:
+    int n;
+    int levels;
+    std::pmr::vector<int> depth;
+    std::pmr::vector<int> tree;
+    std::pmr::vector<int> up;
+    std::pmr::vector<double> maxUp;
+
+public:
+    LiftedForest(int numVertices, size_t numEdges, const int* edgeU, const int* edgeV, const double* weights,
+                 ThreadPool* pool = nullptr,
+                 std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    double pathMax(int a, int b) const;
+    bool connected(int a, int b) const { return tree[a] == tree[b]; }
+};
+
+#endif
\ No newline at end of file
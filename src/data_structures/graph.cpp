@@ -100,4 +100,18 @@ bool Graph::isConnected() const {
     }
     
     return visitedCount == V;
+}
+
+size_t Graph::memoryBytes() const {
+    size_t bytes = sizeof(*this);
+    bytes += adjList.capacity() * sizeof(adjList[0]);
+    for (const auto& neighbors : adjList) {
+        bytes += neighbors.capacity() * sizeof(std::pair<int, double>);
+    }
+    bytes += edgeList.capacity() * sizeof(std::tuple<int, int, double>);
+    bytes += edgeListWithIds.capacity() * sizeof(std::tuple<int, int, double, int>);
+    // unordered_map: bucket array plus one heap node (next pointer + value) per entry
+    bytes += idToEdgeMap.bucket_count() * sizeof(void*);
+    bytes += idToEdgeMap.size() * (sizeof(void*) + sizeof(std::pair<const int, std::tuple<int, int, double>>));
+    return bytes;
 }
\ No newline at end of file
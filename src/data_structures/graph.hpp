@@ -4,9 +4,13 @@
 #include <vector>
 #include <tuple>
 #include <unordered_map>
+#include <cstddef>
+
+class GraphBuilder;
 
 class Graph {
 private:
+    friend class GraphBuilder;
     int V; 
     std::vector<std::vector<std::pair<int, double>>> adjList; 
     std::vector<std::tuple<int, int, double>> edgeList; 
@@ -27,6 +31,7 @@ public:
     const std::unordered_map<int, std::tuple<int, int, double>>& getIdToEdgeMap() const { return idToEdgeMap; }
     static Graph generateRandomGraph(int V, double density, double minWeight = 1.0, double maxWeight = 100.0);
     bool isConnected() const;
+    size_t memoryBytes() const;
 };
 
 #endif
\ No newline at end of file
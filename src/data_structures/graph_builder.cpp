@@ -0,0 +1,159 @@
+#include "graph_builder.hpp"
+#include "../utils/parallel.hpp"
+#include <stdexcept>
+
+GraphBuilder::GraphBuilder(int vertices, size_t expectedEdges, bool isDirected, int threads)
+    : V(vertices), directed(isDirected), numThreads(threads > 0 ? threads : defaultThreadCount()) {
+    edges.reserve(expectedEdges);
+}
+
+void GraphBuilder::reserve(size_t edgeCount) {
+    std::lock_guard<std::mutex> lock(edgesMutex);
+    edges.reserve(edgeCount);
+}
+
+void GraphBuilder::validate(const BuilderEdge* batch, size_t count) const {
+    for (size_t i = 0; i < count; ++i) {
+        if (batch[i].u < 0 || batch[i].u >= V || batch[i].v < 0 || batch[i].v >= V) {
+            throw std::out_of_range("Vertex index out of bounds");
+        }
+    }
+}
+
+void GraphBuilder::addEdge(int u, int v, double weight) {
+    BuilderEdge edge{u, v, weight};
+    addEdges(&edge, 1);
+}
+
+void GraphBuilder::addEdges(const BuilderEdge* batch, size_t count) {
+    validate(batch, count);
+    std::lock_guard<std::mutex> lock(edgesMutex);
+    edges.insert(edges.end(), batch, batch + count);
+}
+
+void GraphBuilder::addEdges(std::vector<BuilderEdge>&& batch) {
+    validate(batch.data(), batch.size());
+    std::lock_guard<std::mutex> lock(edgesMutex);
+    if (edges.empty() && batch.capacity() >= edges.capacity()) {
+        edges.swap(batch);
+    } else {
+        edges.insert(edges.end(), batch.begin(), batch.end());
+    }
+}
+
+void GraphBuilder::addEdges(const std::vector<std::tuple<int, int, double>>& batch) {
+    std::vector<BuilderEdge> converted;
+    converted.reserve(batch.size());
+    for (const auto& edge : batch) {
+        converted.push_back({std::get<0>(edge), std::get<1>(edge), std::get<2>(edge)});
+    }
+    addEdges(converted);
+}
+
+// Counting sort by endpoint: each thread counts its edge chunk, the counts are
+// turned into per-thread write cursors, and the returned offsets delimit the rows.
+std::vector<size_t> GraphBuilder::scatterCursors(bool symmetric,
+                                                 std::vector<std::vector<size_t>>& cursors) const {
+    cursors.assign(numThreads, std::vector<size_t>(V, 0));
+    parallelFor(numThreads, edges.size(), [&](int t, size_t begin, size_t end) {
+        auto& count = cursors[t];
+        for (size_t i = begin; i < end; ++i) {
+            count[edges[i].u]++;
+            if (symmetric) count[edges[i].v]++;
+        }
+    });
+
+    std::vector<size_t> offsets(V + 1, 0);
+    parallelFor(numThreads, V, [&](int, size_t begin, size_t end) {
+        for (size_t u = begin; u < end; ++u) {
+            size_t degree = 0;
+            for (int t = 0; t < numThreads; ++t) {
+                degree += cursors[t][u];
+            }
+            offsets[u + 1] = degree;
+        }
+    });
+    for (int u = 0; u < V; ++u) {
+        offsets[u + 1] += offsets[u];
+    }
+
+    parallelFor(numThreads, V, [&](int, size_t begin, size_t end) {
+        for (size_t u = begin; u < end; ++u) {
+            size_t running = offsets[u];
+            for (int t = 0; t < numThreads; ++t) {
+                size_t count = cursors[t][u];
+                cursors[t][u] = running;
+                running += count;
+            }
+        }
+    });
+    return offsets;
+}
+
+Graph GraphBuilder::build() {
+    Graph graph(V, directed);
+    size_t E = edges.size();
+
+    std::vector<std::vector<size_t>> cursors;
+    std::vector<size_t> offsets = scatterCursors(!directed, cursors);
+
+    graph.edgeList.resize(E);
+    graph.edgeListWithIds.resize(E);
+    parallelFor(numThreads, V, [&](int, size_t begin, size_t end) {
+        for (size_t u = begin; u < end; ++u) {
+            graph.adjList[u].resize(offsets[u + 1] - offsets[u]);
+        }
+    });
+    parallelFor(numThreads, E, [&](int t, size_t begin, size_t end) {
+        auto& cursor = cursors[t];
+        for (size_t i = begin; i < end; ++i) {
+            const BuilderEdge& edge = edges[i];
+            graph.edgeList[i] = {edge.u, edge.v, edge.weight};
+            graph.edgeListWithIds[i] = {edge.u, edge.v, edge.weight, static_cast<int>(i)};
+            graph.adjList[edge.u][cursor[edge.u]++ - offsets[edge.u]] = {edge.v, edge.weight};
+            if (!directed) {
+                graph.adjList[edge.v][cursor[edge.v]++ - offsets[edge.v]] = {edge.u, edge.weight};
+            }
+        }
+    });
+
+    graph.idToEdgeMap.reserve(E);
+    for (size_t i = 0; i < E; ++i) {
+        graph.idToEdgeMap.emplace(static_cast<int>(i), graph.edgeList[i]);
+    }
+    graph.nextEdgeId = static_cast<int>(E);
+
+    edges.clear();
+    edges.shrink_to_fit();
+    return graph;
+}
+
+CSRGraph GraphBuilder::buildCSR() {
+    size_t E = edges.size();
+
+    std::vector<std::vector<size_t>> cursors;
+    std::vector<size_t> offsets = scatterCursors(true, cursors);
+
+    size_t entries = offsets[V];
+    std::vector<int> targets(entries);
+    std::vector<double> weights(entries);
+    std::vector<int> edgeIds(entries);
+    parallelFor(numThreads, E, [&](int t, size_t begin, size_t end) {
+        auto& cursor = cursors[t];
+        for (size_t i = begin; i < end; ++i) {
+            const BuilderEdge& edge = edges[i];
+            size_t k = cursor[edge.u]++;
+            targets[k] = edge.v;
+            weights[k] = edge.weight;
+            edgeIds[k] = static_cast<int>(i);
+            k = cursor[edge.v]++;
+            targets[k] = edge.u;
+            weights[k] = edge.weight;
+            edgeIds[k] = static_cast<int>(i);
+        }
+    });
+
+    edges.clear();
+    edges.shrink_to_fit();
+    return CSRGraph(V, E, std::move(offsets), std::move(targets), std::move(weights), std::move(edgeIds));
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef GRAPH_BUILDER_HPP
+#define GRAPH_BUILDER_HPP
+
+#include "graph.hpp"
+#include "csr_graph.hpp"
+#include <vector>
+#include <tuple>
+#include <mutex>
+#include <cstddef>
+#include <algorithm>
+
+struct BuilderEdge {
+    int u;
+    int v;
+    double weight;
+};
+
+// Collects edges in batches (addEdges is safe to call from several threads) and
+// finalizes them into a Graph or CSRGraph with one parallel counting-sort pass.
+// Edge ids are assigned in insertion order when the graph is built.
+class GraphBuilder {
+private:
+    int V;
+    bool directed;
+    int numThreads;
+    std::vector<BuilderEdge> edges;
+    std::mutex edgesMutex;
+
+    void validate(const BuilderEdge* batch, size_t count) const;
+    std::vector<size_t> scatterCursors(bool symmetric, std::vector<std::vector<size_t>>& cursors) const;
+
+public:
+    GraphBuilder(int vertices, size_t expectedEdges = 0, bool isDirected = false, int threads = 0);
+
+    void reserve(size_t edgeCount);
+    void addEdge(int u, int v, double weight);
+    void addEdges(const BuilderEdge* batch, size_t count);
+    void addEdges(const std::vector<BuilderEdge>& batch) { addEdges(batch.data(), batch.size()); }
+    void addEdges(std::vector<BuilderEdge>&& batch);
+    void addEdges(const std::vector<std::tuple<int, int, double>>& batch);
+
+    // Raises the vertex count; must not race with addEdges.
+    void growVertices(int vertices) { V = std::max(V, vertices); }
+
+    int getVertices() const { return V; }
+    size_t getEdges() const { return edges.size(); }
+
+    // Both leave the builder empty.
+    Graph build();
+    CSRGraph buildCSR();
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,102 @@
+#ifndef INDEXED_DARY_HEAP_HPP
+#define INDEXED_DARY_HEAP_HPP
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+// Min-heap over items 0..capacity-1 with a position map, so every item is in
+// the heap at most once and decreaseKey sifts it up in place. D is the arity.
+template <typename Key, int D = 4>
+class IndexedDaryHeap {
+    static_assert(D >= 2, "heap arity must be at least 2");
+
+private:
+    std::vector<int> heap;
+    std::vector<int> position;
+    std::vector<Key> keys;
+    size_t pushCount = 0;
+    size_t popCount = 0;
+    size_t decreaseCount = 0;
+    size_t peakSize = 0;
+
+    void place(size_t pos, int item) {
+        heap[pos] = item;
+        position[item] = static_cast<int>(pos);
+    }
+
+    void siftUp(size_t pos) {
+        int item = heap[pos];
+        while (pos > 0) {
+            size_t parent = (pos - 1) / D;
+            if (!(keys[item] < keys[heap[parent]])) break;
+            place(pos, heap[parent]);
+            pos = parent;
+        }
+        place(pos, item);
+    }
+
+    void siftDown(size_t pos) {
+        int item = heap[pos];
+        size_t n = heap.size();
+        while (true) {
+            size_t first = pos * D + 1;
+            if (first >= n) break;
+            size_t last = std::min(first + D, n);
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child) {
+                if (keys[heap[child]] < keys[heap[best]]) best = child;
+            }
+            if (!(keys[heap[best]] < keys[item])) break;
+            place(pos, heap[best]);
+            pos = best;
+        }
+        place(pos, item);
+    }
+
+public:
+    explicit IndexedDaryHeap(int capacity) : position(capacity, -1), keys(capacity) {
+        heap.reserve(capacity);
+    }
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+    bool contains(int item) const { return position[item] >= 0; }
+    const Key& key(int item) const { return keys[item]; }
+    int top() const { return heap.front(); }
+
+    void push(int item, const Key& key) {
+        keys[item] = key;
+        heap.push_back(item);
+        siftUp(heap.size() - 1);
+        pushCount++;
+        peakSize = std::max(peakSize, heap.size());
+    }
+
+    // key must not be larger than the item's current key.
+    void decreaseKey(int item, const Key& key) {
+        keys[item] = key;
+        siftUp(position[item]);
+        decreaseCount++;
+    }
+
+    int pop() {
+        int item = heap.front();
+        position[item] = -1;
+        int last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            place(0, last);
+            siftDown(0);
+        }
+        popCount++;
+        return item;
+    }
+
+    size_t getPushCount() const { return pushCount; }
+    size_t getPopCount() const { return popCount; }
+    size_t getDecreaseCount() const { return decreaseCount; }
+    size_t getPeakSize() const { return peakSize; }
+};
+
+#endif
\ No newline at end of file
@@ -2,20 +2,165 @@
 #define UNION_FIND_HPP
 
 #include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#ifdef DEBUG
+#include <stdexcept>
+#endif
 
-class UnionFind {
+// Link policies decide which root becomes the parent and keep whatever
+// per-root state that needs.
+struct UnionByRank {
+    template <typename IndexT>
+    class Linker {
+    private:
+        std::vector<uint8_t> rank;
+    public:
+        explicit Linker(size_t n) : rank(n, 0) {}
+        void link(std::vector<IndexT>& parent, IndexT rootX, IndexT rootY) {
+            if (rank[rootX] < rank[rootY]) {
+                parent[rootX] = rootY;
+            } else if (rank[rootX] > rank[rootY]) {
+                parent[rootY] = rootX;
+            } else {
+                parent[rootY] = rootX;
+                rank[rootX]++;
+            }
+        }
+    };
+};
+
+struct UnionBySize {
+    template <typename IndexT>
+    class Linker {
+    private:
+        std::vector<IndexT> size;
+    public:
+        explicit Linker(size_t n) : size(n, 1) {}
+        void link(std::vector<IndexT>& parent, IndexT rootX, IndexT rootY) {
+            if (size[rootX] < size[rootY]) {
+                std::swap(rootX, rootY);
+            }
+            parent[rootY] = rootX;
+            size[rootX] += size[rootY];
+        }
+    };
+};
+
+struct UnionByIndex {
+    template <typename IndexT>
+    class Linker {
+    public:
+        explicit Linker(size_t) {}
+        void link(std::vector<IndexT>& parent, IndexT rootX, IndexT rootY) {
+            if (rootX < rootY) {
+                parent[rootX] = rootY;
+            } else {
+                parent[rootY] = rootX;
+            }
+        }
+    };
+};
+
+// Compression policies implement an iterative find.
+struct FullCompression {
+    template <typename IndexT>
+    static IndexT find(std::vector<IndexT>& parent, IndexT x) {
+        IndexT root = x;
+        while (parent[root] != root) {
+            root = parent[root];
+        }
+        while (parent[x] != root) {
+            IndexT next = parent[x];
+            parent[x] = root;
+            x = next;
+        }
+        return root;
+    }
+};
+
+struct PathHalving {
+    template <typename IndexT>
+    static IndexT find(std::vector<IndexT>& parent, IndexT x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+};
+
+struct PathSplitting {
+    template <typename IndexT>
+    static IndexT find(std::vector<IndexT>& parent, IndexT x) {
+        while (parent[x] != x) {
+            IndexT next = parent[x];
+            parent[x] = parent[next];
+            x = next;
+        }
+        return x;
+    }
+};
+
+// Disjoint sets over [0, n). Index validation only happens in DEBUG builds so the
+// hot path of Kruskal-style loops is just the find/link work.
+template <typename LinkPolicy = UnionByRank, typename CompressPolicy = PathHalving, typename IndexT = int>
+class UnionFind : private LinkPolicy::template Linker<IndexT> {
 private:
-    mutable std::vector<int> parent;  
-    std::vector<int> rank;
-    int components;
+    using Linker = typename LinkPolicy::template Linker<IndexT>;
+    mutable std::vector<IndexT> parent;
+    IndexT components;
+
+    void check(IndexT x) const {
+#ifdef DEBUG
+        if (static_cast<size_t>(x) >= parent.size()) {
+            throw std::out_of_range("Vertex index out of bounds");
+        }
+#else
+        (void)x;
+#endif
+    }
 
 public:
-    UnionFind(int n);
-    
-    int find(int x) const;  
-    void unite(int x, int y);
-    bool connected(int x, int y) const;  
-    int getComponents() const { return components; }
+    explicit UnionFind(size_t n) : Linker(n), parent(n), components(static_cast<IndexT>(n)) {
+        for (size_t i = 0; i < n; ++i) {
+            parent[i] = static_cast<IndexT>(i);
+        }
+    }
+
+    IndexT find(IndexT x) const {
+        check(x);
+        return CompressPolicy::find(parent, x);
+    }
+
+    // Root lookup without compression; safe to call from several threads as long
+    // as no thread is uniting at the same time.
+    IndexT root(IndexT x) const {
+        check(x);
+        while (parent[x] != x) {
+            x = parent[x];
+        }
+        return x;
+    }
+
+    // Returns true if x and y were in different sets.
+    bool unite(IndexT x, IndexT y) {
+        IndexT rootX = find(x);
+        IndexT rootY = find(y);
+        if (rootX == rootY) {
+            return false;
+        }
+        Linker::link(parent, rootX, rootY);
+        components--;
+        return true;
+    }
+
+    bool connected(IndexT x, IndexT y) const {
+        return find(x) == find(y);
+    }
+
+    IndexT getComponents() const { return components; }
 };
 
 #endif
\ No newline at end of file
@@ -1,133 +1,576 @@
 #include "graph_generator.hpp"
+#include "../algorithms/edge_sort.hpp"
+#include "../data_structures/union_find.hpp"
+#include "../utils/parallel.hpp"
 #include <random>
 #include <algorithm>
-#include <unordered_set>
+#include <numeric>
 #include <iostream>
 #include <utility>
+#include <cmath>
+#include <stdexcept>
 
-GraphGenerator::GraphGenerator(unsigned seed) : rng(seed) {}
+namespace {
+const double PI = 3.14159265358979323846;
 
-Graph GraphGenerator::generateSparseGraph(int V, double averageDegree) {
-    Graph graph(V, false);
-    std::uniform_real_distribution<double> weightDist(1.0, 100.0);
-    for (int i = 1; i < V; ++i) {
-        std::uniform_int_distribution<int> parentDist(0, i-1);
-        int u = parentDist(rng);
-        graph.addEdge(u, i, weightDist(rng));
-    }
-    
-    int targetEdges = static_cast<int>(V * averageDegree / 2);
-    int currentEdges = V - 1;
-    std::unordered_set<long long> existingEdges;
-    for (const auto& edge : graph.getEdgeList()) {
-        int u = std::get<0>(edge);
-        int v = std::get<1>(edge);
-        existingEdges.insert((long long)std::min(u, v) * V + std::max(u, v));
+inline uint64_t pairKey(int u, int v, int V) {
+    if (u > v) std::swap(u, v);
+    return static_cast<uint64_t>(u) * static_cast<uint64_t>(V) + static_cast<uint64_t>(v);
+}
+}
+
+GraphGenerator::GraphGenerator(unsigned seed, int threads)
+    : rng(seed), numThreads(threads > 0 ? threads : defaultThreadCount()), calls(0) {}
+
+template <typename DrawPair>
+void GraphGenerator::addDistinctEdges(int V, uint64_t stream, size_t count, std::vector<BuilderEdge>& edges,
+                                      DrawPair drawPair) const {
+    const uint64_t pairs = static_cast<uint64_t>(V) * (V - 1) / 2;
+    const uint64_t maxDraws = 2 * static_cast<uint64_t>(V) * static_cast<uint64_t>(V);
+    const uint64_t selfLoop = static_cast<uint64_t>(V) * static_cast<uint64_t>(V);
+    size_t need = static_cast<size_t>(std::min<uint64_t>(count, pairs - std::min<uint64_t>(pairs, edges.size())));
+
+    std::vector<uint64_t> acceptedKeys(edges.size());
+    parallelFor(numThreads, edges.size(), [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            acceptedKeys[i] = pairKey(edges[i].u, edges[i].v, V);
+        }
+    });
+
+    // Each round draws a block-aligned batch of candidates, sorts them behind
+    // the accepted keys (the sort is stable, so a repeated pair keeps its
+    // earliest occurrence) and accepts the first `need` new pairs in draw order.
+    // Sampling stops early once a round yields almost nothing new, which only
+    // happens when the reachable pairs are nearly exhausted.
+    uint64_t drawn = 0;
+    while (need > 0 && drawn < maxDraws) {
+        size_t batch = static_cast<size_t>(std::min<uint64_t>(maxDraws - drawn, need + need / 4 + BLOCK));
+        size_t blocks = (batch + BLOCK - 1) / BLOCK;
+        size_t accepted = acceptedKeys.size();
+        std::vector<uint64_t> keys(accepted + batch);
+        std::vector<uint32_t> order(accepted + batch);
+        std::vector<BuilderEdge> candidates(batch);
+        std::copy(acceptedKeys.begin(), acceptedKeys.end(), keys.begin());
+        std::iota(order.begin(), order.end(), 0u);
+        parallelFor(numThreads, blocks, [&](int, size_t firstBlock, size_t lastBlock) {
+            for (size_t i = firstBlock * BLOCK; i < std::min(batch, lastBlock * BLOCK); ++i) {
+                auto [u, v] = drawPair(drawn + i);
+                candidates[i] = {u, v, weightAt(stream + 1, drawn + i, 1.0, 100.0)};
+                keys[accepted + i] = u == v ? selfLoop : pairKey(u, v, V);
+            }
+        });
+        EdgeSorter::radixSort(keys, order, numThreads);
+
+        std::vector<char> fresh(batch, 0);
+        parallelFor(numThreads, keys.size(), [&](int, size_t begin, size_t end) {
+            for (size_t p = begin; p < end; ++p) {
+                if (order[p] >= accepted && keys[p] != selfLoop && (p == 0 || keys[p] != keys[p - 1])) {
+                    fresh[order[p] - accepted] = 1;
+                }
+            }
+        });
+
+        std::vector<size_t> offsets(blocks, 0);
+        parallelFor(numThreads, blocks, [&](int, size_t firstBlock, size_t lastBlock) {
+            for (size_t b = firstBlock; b < lastBlock; ++b) {
+                for (size_t i = b * BLOCK; i < std::min(batch, (b + 1) * BLOCK); ++i) {
+                    offsets[b] += fresh[i];
+                }
+            }
+        });
+        size_t total = 0;
+        for (auto& offset : offsets) {
+            size_t value = offset;
+            offset = total;
+            total += value;
+        }
+
+        size_t take = std::min(total, need);
+        size_t base = edges.size();
+        edges.resize(base + take);
+        acceptedKeys.resize(accepted + take);
+        parallelFor(numThreads, blocks, [&](int, size_t firstBlock, size_t lastBlock) {
+            for (size_t b = firstBlock; b < lastBlock; ++b) {
+                size_t position = offsets[b];
+                for (size_t i = b * BLOCK; i < std::min(batch, (b + 1) * BLOCK) && position < take; ++i) {
+                    if (!fresh[i]) continue;
+                    edges[base + position] = candidates[i];
+                    acceptedKeys[accepted + position] = pairKey(candidates[i].u, candidates[i].v, V);
+                    position++;
+                }
+            }
+        });
+        need -= take;
+        drawn += batch;
+        if (total < batch / 64) break;
     }
-    
-    std::uniform_int_distribution<int> vertexDist(0, V-1);
-    int attempts = 0;
-    int maxAttempts = V * V * 2; 
-    
-    while (currentEdges < targetEdges && attempts < maxAttempts) {
-        int u = vertexDist(rng);
-        int v = vertexDist(rng);
-        if (u == v) continue;
-        
-        long long edgeKey = (long long)std::min(u, v) * V + std::max(u, v);
-        if (existingEdges.find(edgeKey) == existingEdges.end()) {
-            graph.addEdge(u, v, weightDist(rng));
-            existingEdges.insert(edgeKey);
-            currentEdges++;
+}
+
+Graph GraphGenerator::generateSparseGraph(int V, double averageDegree) {
+    uint64_t stream = nextStream();
+    size_t treeEdges = V > 0 ? static_cast<size_t>(V - 1) : 0;
+    size_t targetEdges = static_cast<size_t>(V * averageDegree / 2);
+    std::vector<BuilderEdge> batch;
+    batch.reserve(std::max(targetEdges, treeEdges));
+    batch.resize(treeEdges);
+    parallelFor(numThreads, treeEdges, [&](int, size_t begin, size_t end) {
+        for (size_t k = begin; k < end; ++k) {
+            int i = static_cast<int>(k) + 1;
+            int u = scaleBits32(rng.bits(stream, k) >> 32, i);
+            batch[k] = {u, i, weightAt(stream + 1, k, 1.0, 100.0)};
         }
-        attempts++;
+    });
+    if (targetEdges > treeEdges) {
+        addDistinctEdges(V, stream + 2, targetEdges - treeEdges, batch, [&](uint64_t index) {
+            uint64_t bits = rng.bits(stream + 2, index);
+            return std::make_pair(scaleBits32(bits >> 32, V), scaleBits32(bits & 0xFFFFFFFFULL, V));
+        });
     }
-    
-    return graph;
+
+    GraphBuilder builder(V, 0, false, numThreads);
+    builder.addEdges(std::move(batch));
+    return builder.build();
 }
 
 Graph GraphGenerator::generateDenseGraph(int V, double density) {
-    Graph graph(V, false);
-    std::uniform_real_distribution<double> weightDist(1.0, 100.0);
-    for (int i = 1; i < V; ++i) {
-        graph.addEdge(i-1, i, weightDist(rng));
+    uint64_t stream = nextStream();
+    size_t maxEdges = V > 1 ? static_cast<size_t>(V) * (V - 1) / 2 : 0;
+    size_t pathEdges = V > 0 ? static_cast<size_t>(V - 1) : 0;
+    size_t targetEdges = std::min(maxEdges, static_cast<size_t>(density * maxEdges));
+    std::vector<BuilderEdge> batch;
+    batch.reserve(std::max(targetEdges, pathEdges));
+    batch.resize(pathEdges);
+    parallelFor(numThreads, pathEdges, [&](int, size_t begin, size_t end) {
+        for (size_t k = begin; k < end; ++k) {
+            int i = static_cast<int>(k) + 1;
+            batch[k] = {i - 1, i, weightAt(stream + 1, k, 1.0, 100.0)};
+        }
+    });
+    if (targetEdges > pathEdges) {
+        addDensePairs(V, stream + 2, targetEdges - pathEdges, batch);
     }
-    
-    int maxEdges = V * (V - 1) / 2;
-    int targetEdges = static_cast<int>(density * maxEdges);
 
-    std::vector<std::pair<int, int>> possibleEdges;
-    for (int i = 0; i < V; ++i) {
-        for (int j = i + 1; j < V; ++j) {
-            possibleEdges.push_back({i, j});
-        }
+    GraphBuilder builder(V, 0, false, numThreads);
+    builder.addEdges(std::move(batch));
+    return builder.build();
+}
+
+void GraphGenerator::addDensePairs(int V, uint64_t stream, size_t count, std::vector<BuilderEdge>& edges) const {
+    const uint64_t candidates = static_cast<uint64_t>(V - 1) * (V - 2) / 2;
+    count = static_cast<size_t>(std::min<uint64_t>(count, candidates));
+
+    std::vector<std::vector<BuilderEdge>> parts(numThreads);
+    std::vector<std::vector<uint64_t>> priorities(numThreads);
+    size_t sampled = 0;
+    for (uint64_t attempt = 0; sampled < count; ++attempt) {
+        // Oversample by a few standard deviations so one pass almost always
+        // yields enough pairs; a short pass is simply redrawn on a new stream.
+        double expected = count + (3.0 + 3.0 * attempt) * std::sqrt(static_cast<double>(count)) + 16.0;
+        double p = std::min(1.0, expected / static_cast<double>(candidates));
+        double logSkip = std::log1p(-p);
+        uint64_t passStream = stream ^ (attempt << 40);
+        // Row i holds the pairs (i, j) with j >= i + 2; the path already has (i, i + 1).
+        parallelFor(numThreads, V > 2 ? V - 2 : 0, [&](int t, size_t begin, size_t end) {
+            auto& part = parts[t];
+            auto& priority = priorities[t];
+            part.clear();
+            priority.clear();
+            for (size_t i = begin; i < end; ++i) {
+                uint64_t rowBase = i * static_cast<uint64_t>(V);
+                uint64_t draw = 0;
+                for (uint64_t j = i + 2; j < static_cast<uint64_t>(V); ++j) {
+                    if (p < 1.0) {
+                        double u = 1.0 - rng.uniform(passStream, rowBase + draw++);
+                        double skip = std::floor(std::log(u) / logSkip);
+                        if (skip >= static_cast<double>(V - j)) break;
+                        j += static_cast<uint64_t>(skip);
+                    }
+                    part.push_back({static_cast<int>(i), static_cast<int>(j), 0.0});
+                    priority.push_back(rng.bits(stream + 1, rowBase + j));
+                }
+            }
+        });
+        sampled = 0;
+        for (const auto& part : parts) sampled += part.size();
     }
-    
-    std::shuffle(possibleEdges.begin(), possibleEdges.end(), rng);
-    
-    std::unordered_set<long long> existingEdges;
-    for (const auto& edge : graph.getEdgeList()) {
-        int u = std::get<0>(edge);
-        int v = std::get<1>(edge);
-        existingEdges.insert((long long)std::min(u, v) * V + std::max(u, v));
+
+    // The Bernoulli sample is uniform given its size, so keeping the `count`
+    // pairs with the smallest random priorities leaves a uniform count-subset.
+    uint64_t threshold = UINT64_MAX;
+    if (sampled > count) {
+        std::vector<uint64_t> ranked;
+        ranked.reserve(sampled);
+        for (const auto& priority : priorities) ranked.insert(ranked.end(), priority.begin(), priority.end());
+        std::nth_element(ranked.begin(), ranked.begin() + (count - 1), ranked.end());
+        threshold = ranked[count - 1];
     }
-    
-    int edgesAdded = V - 1;
-    for (const auto& edge : possibleEdges) {
-        if (edgesAdded >= targetEdges) break;
-        int u = edge.first;
-        int v = edge.second;
-        long long edgeKey = (long long)u * V + v;
-        
-        if (existingEdges.find(edgeKey) == existingEdges.end()) {
-            graph.addEdge(u, v, weightDist(rng));
-            existingEdges.insert(edgeKey);
-            edgesAdded++;
-        }
+
+    std::vector<size_t> offsets(numThreads, 0);
+    for (int t = 0; t < numThreads; ++t) {
+        for (uint64_t priority : priorities[t]) offsets[t] += priority <= threshold;
     }
-    return graph;
+    size_t total = 0;
+    for (auto& offset : offsets) {
+        size_t value = offset;
+        offset = total;
+        total += value;
+    }
+    size_t base = edges.size();
+    edges.resize(base + std::min(total, count));
+    parallelFor(numThreads, numThreads, [&](int, size_t begin, size_t end) {
+        for (size_t t = begin; t < end; ++t) {
+            size_t position = offsets[t];
+            for (size_t k = 0; k < parts[t].size() && position < count; ++k) {
+                if (priorities[t][k] > threshold) continue;
+                BuilderEdge edge = parts[t][k];
+                edge.weight = weightAt(stream + 2, static_cast<uint64_t>(edge.u) * V + edge.v, 1.0, 100.0);
+                edges[base + position++] = edge;
+            }
+        }
+    });
 }
 
 Graph GraphGenerator::generateCompleteGraph(int V) {
-    Graph graph(V, false);
-    std::uniform_real_distribution<double> weightDist(1.0, 100.0);
-    
-    for (int i = 0; i < V; ++i) {
-        for (int j = i + 1; j < V; ++j) {
-            graph.addEdge(i, j, weightDist(rng));
+    uint64_t stream = nextStream();
+    GraphBuilder builder(V, 0, false, numThreads);
+    std::vector<BuilderEdge> batch(static_cast<size_t>(V) * (V - 1) / 2);
+    parallelFor(numThreads, V, [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            size_t k = i * (2 * static_cast<size_t>(V) - i - 1) / 2;
+            for (int j = static_cast<int>(i) + 1; j < V; ++j, ++k) {
+                batch[k] = {static_cast<int>(i), j, weightAt(stream, k, 1.0, 100.0)};
+            }
         }
-    }
+    });
     
-    return graph;
+    builder.addEdges(std::move(batch));
+    return builder.build();
 }
 
 Graph GraphGenerator::generateGridGraph(int rows, int cols) {
+    uint64_t stream = nextStream();
     int V = rows * cols;
-    Graph graph(V, false);
-    std::uniform_real_distribution<double> weightDist(1.0, 10.0);
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < cols; ++j) {
-            int current = i * cols + j;
-            if (j < cols - 1) {
-                int right = i * cols + (j + 1);
-                graph.addEdge(current, right, weightDist(rng));
-            }
-            if (i < rows - 1) {
-                int down = (i + 1) * cols + j;
-                graph.addEdge(current, down, weightDist(rng));
+    GraphBuilder builder(V, 0, false, numThreads);
+    size_t rowStride = 2 * static_cast<size_t>(cols) - 1;
+    size_t edgeCount = rows > 0 && cols > 0
+        ? static_cast<size_t>(rows) * (cols - 1) + static_cast<size_t>(rows - 1) * cols : 0;
+    std::vector<BuilderEdge> batch(edgeCount);
+    parallelFor(numThreads, rows, [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            size_t k = i * rowStride;
+            for (int j = 0; j < cols; ++j) {
+                int current = static_cast<int>(i) * cols + j;
+                if (j < cols - 1) {
+                    batch[k] = {current, current + 1, weightAt(stream, k, 1.0, 10.0)};
+                    k++;
+                }
+                if (static_cast<int>(i) < rows - 1) {
+                    batch[k] = {current, current + cols, weightAt(stream, k, 1.0, 10.0)};
+                    k++;
+                }
             }
         }
-    }
+    });
     
-    return graph;
+    builder.addEdges(std::move(batch));
+    return builder.build();
 }
 
 Graph GraphGenerator::generateGraphWithParameters(int V, int E) {
-    double density = static_cast<double>(2 * E) / (V * (V - 1));
+    double density = 2.0 * E / (static_cast<double>(V) * (V - 1));
     if (density < 0.3) {
-        double averageDegree = static_cast<double>(2 * E) / V;
+        double averageDegree = 2.0 * E / V;
         return generateSparseGraph(V, averageDegree);
     } else {
         return generateDenseGraph(V, density);
     }
+}
+
+template <typename WeightOf>
+void GraphGenerator::connectComponents(int V, uint64_t stream, std::vector<BuilderEdge>& edges,
+                                       WeightOf weightOf) const {
+    if (V < 2) return;
+    UnionFind<> uf(V);
+    for (const auto& edge : edges) uf.unite(edge.u, edge.v);
+
+    // Number components by smallest vertex and list each one's members.
+    std::vector<int> componentOf(V, -1);
+    std::vector<int> rootComponent(V, -1);
+    int components = 0;
+    for (int v = 0; v < V; ++v) {
+        int root = uf.find(v);
+        if (rootComponent[root] < 0) rootComponent[root] = components++;
+        componentOf[v] = rootComponent[root];
+    }
+    if (components == 1) return;
+    std::vector<size_t> start(components + 1, 0);
+    for (int v = 0; v < V; ++v) start[componentOf[v] + 1]++;
+    for (int c = 0; c < components; ++c) start[c + 1] += start[c];
+    std::vector<int> members(V);
+    std::vector<size_t> cursor(start.begin(), start.end() - 1);
+    for (int v = 0; v < V; ++v) members[cursor[componentOf[v]]++] = v;
+
+    // Members are grouped by component in order, so the vertices joined so far
+    // are exactly members[0 .. start[c]).
+    for (int c = 1; c < components; ++c) {
+        uint64_t bits = rng.bits(stream, c);
+        size_t size = start[c + 1] - start[c];
+        int u = members[start[c] + scaleBits32(bits >> 32, static_cast<uint32_t>(size))];
+        int v = members[scaleBits32(bits & 0xFFFFFFFFULL, static_cast<uint32_t>(start[c]))];
+        edges.push_back({std::min(u, v), std::max(u, v), weightOf(u, v, static_cast<uint64_t>(c))});
+    }
+}
+
+Graph GraphGenerator::generateRMATGraph(int V, double averageDegree, double a, double b, double c) {
+    uint64_t stream = nextStream();
+    int levels = rmatLevels(V);
+    std::vector<BuilderEdge> batch;
+    addDistinctEdges(V, stream, static_cast<size_t>(V * averageDegree / 2), batch, [&](uint64_t index) {
+        auto [u, v] = rmatCell(rng.bits(stream + 2, index), levels, a, b, c);
+        // Cells outside the V x V corner are rejected like self-loops.
+        if (u >= V || v >= V) return std::make_pair(0, 0);
+        return std::make_pair(u, v);
+    });
+    connectComponents(V, stream + 6, batch, [&](int, int, uint64_t index) {
+        return weightAt(stream + 7, index, 1.0, 100.0);
+    });
+
+    GraphBuilder builder(V, 0, false, numThreads);
+    builder.addEdges(std::move(batch));
+    return builder.build();
+}
+
+Graph GraphGenerator::generatePowerLawGraph(int V, double averageDegree, double exponent) {
+    uint64_t stream = nextStream();
+    std::vector<double> cumulative = powerLawCumulative(V, exponent);
+    std::vector<BuilderEdge> batch;
+    addDistinctEdges(V, stream, static_cast<size_t>(V * averageDegree / 2), batch, [&](uint64_t index) {
+        uint64_t bits = rng.bits(stream + 2, index);
+        return std::make_pair(pickCumulative(cumulative, bits >> 32), pickCumulative(cumulative, bits & 0xFFFFFFFFULL));
+    });
+    connectComponents(V, stream + 6, batch, [&](int, int, uint64_t index) {
+        return weightAt(stream + 7, index, 1.0, 100.0);
+    });
+
+    GraphBuilder builder(V, 0, false, numThreads);
+    builder.addEdges(std::move(batch));
+    return builder.build();
+}
+
+int GraphGenerator::rmatLevels(int V) {
+    int levels = 0;
+    while (levels < 31 && (1LL << levels) < V) levels++;
+    return levels;
+}
+
+std::pair<int, int> GraphGenerator::rmatCell(uint64_t state, int levels, double a, double b, double c) {
+    int u = 0;
+    int v = 0;
+    for (int level = 0; level < levels; ++level) {
+        state += GOLDEN_GAMMA;
+        double r = toUnitInterval(mix64(state));
+        int quadrant = r < a ? 0 : r < a + b ? 1 : r < a + b + c ? 2 : 3;
+        u = 2 * u + (quadrant >> 1);
+        v = 2 * v + (quadrant & 1);
+    }
+    return {u, v};
+}
+
+std::vector<double> GraphGenerator::powerLawCumulative(int V, double exponent) {
+    std::vector<double> cumulative(V);
+    double total = 0.0;
+    for (int i = 0; i < V; ++i) {
+        total += std::pow(i + 1.0, -1.0 / (exponent - 1.0));
+        cumulative[i] = total;
+    }
+    return cumulative;
+}
+
+int GraphGenerator::pickCumulative(const std::vector<double>& cumulative, uint64_t bits32) {
+    double target = static_cast<double>(bits32) * 0x1.0p-32 * cumulative.back();
+    auto it = std::upper_bound(cumulative.begin(), cumulative.end(), target);
+    return static_cast<int>(std::min<ptrdiff_t>(it - cumulative.begin(), cumulative.size() - 1));
+}
+
+std::vector<std::pair<double, double>> GraphGenerator::drawPoints(int V, uint64_t stream) const {
+    std::vector<std::pair<double, double>> points(V);
+    parallelFor(numThreads, V, [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            points[i] = {rng.uniform(stream, 2 * i), rng.uniform(stream, 2 * i + 1)};
+        }
+    });
+    return points;
+}
+
+namespace {
+// Points bucketed into a cells x cells grid over the unit square; the members
+// of cell k are order[start[k] .. start[k + 1]).
+struct PointGrid {
+    int cells;
+    std::vector<size_t> start;
+    std::vector<int> order;
+
+    PointGrid(const std::vector<std::pair<double, double>>& points, int cellsPerSide)
+        : cells(std::max(1, cellsPerSide)), start(static_cast<size_t>(cells) * cells + 1, 0), order(points.size()) {
+        std::vector<size_t> cellOf(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            cellOf[i] = static_cast<size_t>(row(points[i].second)) * cells + row(points[i].first);
+            start[cellOf[i] + 1]++;
+        }
+        for (size_t k = 0; k + 1 < start.size(); ++k) start[k + 1] += start[k];
+        std::vector<size_t> cursor(start.begin(), start.end() - 1);
+        for (size_t i = 0; i < points.size(); ++i) order[cursor[cellOf[i]]++] = static_cast<int>(i);
+    }
+
+    int row(double coordinate) const { return std::min(cells - 1, static_cast<int>(coordinate * cells)); }
+};
+
+inline double distance(const std::pair<double, double>& p, const std::pair<double, double>& q) {
+    return std::hypot(p.first - q.first, p.second - q.second);
+}
+}
+
+Graph GraphGenerator::generateGeometricGraph(int V, double radius) {
+    uint64_t stream = nextStream();
+    auto points = drawPoints(V, stream);
+    // Cells at least radius wide, so every neighbour is in the 3 x 3 block.
+    PointGrid grid(points, static_cast<int>(std::min(1.0 / radius, std::sqrt(static_cast<double>(V)) + 1.0)));
+
+    std::vector<std::vector<BuilderEdge>> parts(numThreads);
+    parallelFor(numThreads, V, [&](int t, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            int cx = grid.row(points[i].first);
+            int cy = grid.row(points[i].second);
+            for (int y = std::max(0, cy - 1); y <= std::min(grid.cells - 1, cy + 1); ++y) {
+                for (int x = std::max(0, cx - 1); x <= std::min(grid.cells - 1, cx + 1); ++x) {
+                    size_t cell = static_cast<size_t>(y) * grid.cells + x;
+                    for (size_t k = grid.start[cell]; k < grid.start[cell + 1]; ++k) {
+                        int j = grid.order[k];
+                        if (j <= static_cast<int>(i)) continue;
+                        double d = distance(points[i], points[j]);
+                        if (d <= radius) parts[t].push_back({static_cast<int>(i), j, d});
+                    }
+                }
+            }
+        }
+    });
+
+    std::vector<BuilderEdge> batch;
+    for (auto& part : parts) {
+        batch.insert(batch.end(), part.begin(), part.end());
+        std::vector<BuilderEdge>().swap(part);
+    }
+    connectComponents(V, stream + 6, batch, [&](int u, int v, uint64_t) { return distance(points[u], points[v]); });
+
+    GraphBuilder builder(V, 0, false, numThreads);
+    builder.addEdges(std::move(batch));
+    return builder.build();
+}
+
+Graph GraphGenerator::generateKNNGraph(int V, int k) {
+    uint64_t stream = nextStream();
+    auto points = drawPoints(V, stream);
+    k = std::max(0, std::min(k, V - 1));
+    PointGrid grid(points, static_cast<int>(std::sqrt(static_cast<double>(V) / std::max(1, k))));
+    double cellSize = 1.0 / grid.cells;
+
+    // Rings of cells are searched outwards until the k-th nearest candidate is
+    // closer than anything an unsearched ring could hold.
+    std::vector<std::vector<BuilderEdge>> parts(numThreads);
+    parallelFor(numThreads, V, [&](int t, size_t begin, size_t end) {
+        std::vector<std::pair<double, int>> nearest;
+        for (size_t i = begin; i < end && k > 0; ++i) {
+            int cx = grid.row(points[i].first);
+            int cy = grid.row(points[i].second);
+            nearest.clear();
+            for (int ring = 0; ring < grid.cells; ++ring) {
+                for (int y = cy - ring; y <= cy + ring; ++y) {
+                    if (y < 0 || y >= grid.cells) continue;
+                    bool edgeRow = y == cy - ring || y == cy + ring;
+                    for (int x = cx - ring; x <= cx + ring; x += edgeRow ? 1 : 2 * std::max(ring, 1)) {
+                        if (x < 0 || x >= grid.cells) continue;
+                        size_t cell = static_cast<size_t>(y) * grid.cells + x;
+                        for (size_t m = grid.start[cell]; m < grid.start[cell + 1]; ++m) {
+                            int j = grid.order[m];
+                            if (j == static_cast<int>(i)) continue;
+                            nearest.push_back({distance(points[i], points[j]), j});
+                            std::push_heap(nearest.begin(), nearest.end());
+                            if (static_cast<int>(nearest.size()) > k) {
+                                std::pop_heap(nearest.begin(), nearest.end());
+                                nearest.pop_back();
+                            }
+                        }
+                    }
+                }
+                if (static_cast<int>(nearest.size()) == k && nearest.front().first <= ring * cellSize) break;
+            }
+            for (const auto& [d, j] : nearest) {
+                parts[t].push_back({std::min(static_cast<int>(i), j), std::max(static_cast<int>(i), j), d});
+            }
+        }
+    });
+
+    // Mutual neighbours produce the same pair twice; keep one copy.
+    std::vector<BuilderEdge> batch;
+    for (auto& part : parts) batch.insert(batch.end(), part.begin(), part.end());
+    std::vector<uint64_t> keys(batch.size());
+    std::vector<uint32_t> order(batch.size());
+    parallelFor(numThreads, batch.size(), [&](int, size_t begin, size_t end) {
+        for (size_t m = begin; m < end; ++m) {
+            keys[m] = pairKey(batch[m].u, batch[m].v, V);
+            order[m] = static_cast<uint32_t>(m);
+        }
+    });
+    EdgeSorter::radixSort(keys, order, numThreads);
+    std::vector<BuilderEdge> unique;
+    unique.reserve(batch.size());
+    for (size_t m = 0; m < keys.size(); ++m) {
+        if (m == 0 || keys[m] != keys[m - 1]) unique.push_back(batch[order[m]]);
+    }
+    connectComponents(V, stream + 6, unique, [&](int u, int v, uint64_t) { return distance(points[u], points[v]); });
+
+    GraphBuilder builder(V, 0, false, numThreads);
+    builder.addEdges(std::move(unique));
+    return builder.build();
+}
+
+Graph GraphGenerator::generate(GraphFamily family, int V, double density) {
+    switch (family) {
+        case GraphFamily::Uniform:
+            return density < 1.0 ? generateDenseGraph(V, density) : generateSparseGraph(V, density);
+        case GraphFamily::RMAT:
+            return generateRMATGraph(V, density);
+        case GraphFamily::Geometric:
+            return generateGeometricGraph(V, std::sqrt(density / (PI * std::max(1, V - 1))));
+        case GraphFamily::KNN:
+            // Symmetrizing a planar k-NN graph gives an average degree of about 1.2k.
+            return generateKNNGraph(V, std::max(1, static_cast<int>(std::lround(density / 1.2))));
+        case GraphFamily::PowerLaw:
+            return generatePowerLawGraph(V, density);
+        case GraphFamily::Grid: {
+            int rows = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(V))));
+            return generateGridGraph(rows, V / rows);
+        }
+    }
+    throw std::invalid_argument("Unknown graph family");
+}
+
+std::string GraphGenerator::familyName(GraphFamily family) {
+    switch (family) {
+        case GraphFamily::Uniform: return "uniform";
+        case GraphFamily::RMAT: return "rmat";
+        case GraphFamily::Geometric: return "geometric";
+        case GraphFamily::KNN: return "knn";
+        case GraphFamily::PowerLaw: return "powerlaw";
+        case GraphFamily::Grid: return "grid";
+    }
+    return "unknown";
+}
+
+GraphFamily GraphGenerator::parseFamily(const std::string& name) {
+    for (GraphFamily family : {GraphFamily::Uniform, GraphFamily::RMAT, GraphFamily::Geometric,
+                               GraphFamily::KNN, GraphFamily::PowerLaw, GraphFamily::Grid}) {
+        if (familyName(family) == name) return family;
+    }
+    throw std::invalid_argument("Unknown graph family: " + name);
 }
\ No newline at end of file
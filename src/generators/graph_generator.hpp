@@ -2,14 +2,64 @@
 #define GRAPH_GENERATOR_HPP
 
 #include "../data_structures/graph.hpp"
+#include "../data_structures/graph_builder.hpp"
+#include "../utils/random.hpp"
 #include <random>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
 
+enum class GraphFamily {
+    Uniform,    // generateSparseGraph, or generateDenseGraph for density < 1
+    RMAT,       // recursive-matrix graph with skewed degrees and communities
+    Geometric,  // points in the unit square joined within a radius
+    KNN,        // points in the unit square joined to their nearest neighbours
+    PowerLaw,   // Chung-Lu graph with a power-law expected degree sequence
+    Grid        // rows x cols lattice with rows = floor(sqrt(V)); V rounds down to rows * cols
+};
+
+// Random graphs drawn from a counter-based RNG: every endpoint and weight is a
+// pure function of (seed, call, index), and indices are generated in fixed
+// blocks spread over the threads, so a seed produces the same graph for any
+// thread count. Each generate call uses a fresh stream, so successive calls on
+// one generator still differ.
 class GraphGenerator {
 private:
-    std::mt19937 rng;
-    
+    CounterRng rng;
+    int numThreads;
+    uint64_t calls;
+
+    static constexpr size_t BLOCK = 4096;
+
+    uint64_t nextStream() { return calls++ * 8; }
+    double weightAt(uint64_t stream, uint64_t index, double low, double high) const {
+        return low + (high - low) * rng.uniform(stream, index);
+    }
+    // Adds `count` distinct pairs that are not yet in `edges`, drawing the
+    // i-th candidate as drawPair(i) (self-loops are rejected) and keeping the
+    // candidates with the lowest draw index.
+    template <typename DrawPair>
+    void addDistinctEdges(int V, uint64_t stream, size_t count, std::vector<BuilderEdge>& edges,
+                          DrawPair drawPair) const;
+    // Adds a uniform `count`-subset of the pairs (i, j) with j > i + 1 by
+    // geometric skip sampling along each row, in O(V + count) time and space.
+    void addDensePairs(int V, uint64_t stream, size_t count, std::vector<BuilderEdge>& edges) const;
+    // Makes `edges` connected with one extra edge per additional component: in
+    // order of their smallest vertex, each component links a random member to
+    // a random vertex of the components before it, weighted weightOf(u, v, i).
+    template <typename WeightOf>
+    void connectComponents(int V, uint64_t stream, std::vector<BuilderEdge>& edges, WeightOf weightOf) const;
+    std::vector<std::pair<double, double>> drawPoints(int V, uint64_t stream) const;
+
 public:
-    GraphGenerator(unsigned seed = std::random_device{}());
+    static constexpr double RMAT_A = 0.57;
+    static constexpr double RMAT_B = 0.19;
+    static constexpr double RMAT_C = 0.19;
+    static constexpr double POWER_LAW_EXPONENT = 2.5;
+
+    GraphGenerator(unsigned seed = std::random_device{}(), int threads = 0);
     
     Graph generateSparseGraph(int V, double averageDegree = 6.0);
     Graph generateDenseGraph(int V, double density = 0.5);
@@ -17,6 +67,37 @@ public:
     Graph generateGridGraph(int rows, int cols);
     
     Graph generateGraphWithParameters(int V, int E);
+
+    // Each edge descends log2(V) levels of the adjacency matrix, picking the
+    // quadrants with probabilities a, b, c and 1 - a - b - c.
+    Graph generateRMATGraph(int V, double averageDegree = 8.0, double a = RMAT_A, double b = RMAT_B,
+                            double c = RMAT_C);
+    // Edge weights are the Euclidean distances between the points.
+    Graph generateGeometricGraph(int V, double radius);
+    Graph generateKNNGraph(int V, int k);
+    // Endpoints are drawn with probability proportional to (i + 1)^(-1 / (exponent - 1)),
+    // so the degree distribution has the given power-law exponent.
+    Graph generatePowerLawGraph(int V, double averageDegree = 8.0, double exponent = POWER_LAW_EXPONENT);
+
+    // Uniform follows the runners' convention (density < 1 is an edge
+    // fraction, otherwise an average degree); the other families read density
+    // as the target average degree. Every family is connected: Uniform and
+    // Grid by construction, the others by connectComponents, which adds one
+    // edge per extra component with a weight from the family's own
+    // distribution (uniform in [1, 100) for R-MAT and power-law, the point
+    // distance for geometric and k-NN).
+    Graph generate(GraphFamily family, int V, double density);
+    static std::string familyName(GraphFamily family);
+    static GraphFamily parseFamily(const std::string& name);
+
+    // Endpoint distributions shared with StreamGenerator, so both draw the same families.
+    static int rmatLevels(int V);
+    // The matrix cell reached by `levels` quadrant choices seeded from state.
+    static std::pair<int, int> rmatCell(uint64_t state, int levels, double a, double b, double c);
+    // Running sums of the power-law endpoint weights (i + 1)^(-1 / (exponent - 1)).
+    static std::vector<double> powerLawCumulative(int V, double exponent);
+    // Index drawn in proportion to the cumulative weights from 32 random bits.
+    static int pickCumulative(const std::vector<double>& cumulative, uint64_t bits32);
 };
 
 #endif
\ No newline at end of file
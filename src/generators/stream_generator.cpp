@@ -0,0 +1,364 @@
+#include "stream_generator.hpp"
+#include "../io/graph_file.hpp"
+#include "../utils/parallel.hpp"
+#include "../utils/timer.hpp"
+#include <vector>
+#include <tuple>
+#include <atomic>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+// One family's edges as numbered blocks; emit(block, f) calls f(u, v, weight)
+// for that block's edges in a fixed order.
+class EdgeSource {
+private:
+    const CounterRng& rng;
+    GraphFamily family;
+    int cols;
+    int levels;
+    bool denseRows;
+    uint64_t draws;
+    double keep;
+    std::vector<double> cumulative;
+
+    double weight(uint64_t index, double low, double high) const {
+        return low + (high - low) * rng.uniform(1, index);
+    }
+
+public:
+    int vertices;
+
+    EdgeSource(const CounterRng& generator, GraphFamily graphFamily, int V, double density)
+        : rng(generator), family(graphFamily), cols(0), levels(0), denseRows(false), draws(0), keep(0.0), vertices(V) {
+        switch (family) {
+            case GraphFamily::Uniform:
+                denseRows = density < 1.0;
+                if (denseRows) {
+                    double candidates = static_cast<double>(V - 1) * (V - 2) / 2;
+                    double extra = density * V * (V - 1) / 2 - (V - 1);
+                    keep = candidates > 0 ? std::clamp(extra / candidates, 0.0, 1.0) : 0.0;
+                } else {
+                    // At least the V - 1 spanning-tree draws, like GraphGenerator::generateSparseGraph.
+                    draws = std::max<uint64_t>(V > 0 ? V - 1 : 0, static_cast<uint64_t>(V * density / 2));
+                }
+                break;
+            case GraphFamily::Grid: {
+                int rows = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(V))));
+                cols = V / rows;
+                vertices = rows * cols;
+                break;
+            }
+            case GraphFamily::PowerLaw:
+                draws = static_cast<uint64_t>(V * density / 2);
+                cumulative = GraphGenerator::powerLawCumulative(V, GraphGenerator::POWER_LAW_EXPONENT);
+                break;
+            case GraphFamily::RMAT:
+                draws = static_cast<uint64_t>(V * density / 2);
+                levels = GraphGenerator::rmatLevels(V);
+                break;
+            default:
+                throw std::invalid_argument("Streaming does not support the " +
+                                            GraphGenerator::familyName(family) + " family");
+        }
+    }
+
+    size_t blocks() const {
+        if (family == GraphFamily::Grid) return vertices / std::max(1, cols);
+        if (denseRows) return vertices;
+        return static_cast<size_t>((draws + StreamGenerator::BLOCK - 1) / StreamGenerator::BLOCK);
+    }
+
+    template <typename Emit>
+    void emit(size_t block, Emit&& emit) const {
+        const uint64_t V = static_cast<uint64_t>(vertices);
+        if (family == GraphFamily::Grid) {
+            for (int c = 0; c < cols; ++c) {
+                int current = static_cast<int>(block) * cols + c;
+                uint64_t index = 2 * static_cast<uint64_t>(current);
+                if (c + 1 < cols) emit(current, current + 1, weight(index, 1.0, 10.0));
+                if (current + cols < vertices) emit(current, current + cols, weight(index + 1, 1.0, 10.0));
+            }
+            return;
+        }
+        if (denseRows) {
+            // Dense rows: the path edge, then each pair (i, j > i + 1) kept
+            // independently with probability `keep`, found by geometric skips.
+            uint64_t i = block;
+            if (i + 1 < V) emit(static_cast<int>(i), static_cast<int>(i + 1), weight(i * V + i + 1, 1.0, 100.0));
+            if (keep <= 0.0) return;
+            double logSkip = std::log1p(-keep);
+            uint64_t draw = 0;
+            for (uint64_t j = i + 2; j < V; ++j) {
+                if (keep < 1.0) {
+                    double skip = std::floor(std::log(1.0 - rng.uniform(0, i * V + draw++)) / logSkip);
+                    if (skip >= static_cast<double>(V - j)) break;
+                    j += static_cast<uint64_t>(skip);
+                }
+                emit(static_cast<int>(i), static_cast<int>(j), weight(i * V + j, 1.0, 100.0));
+            }
+            return;
+        }
+        uint64_t end = std::min<uint64_t>(draws, (block + 1) * StreamGenerator::BLOCK);
+        for (uint64_t k = block * StreamGenerator::BLOCK; k < end; ++k) {
+            uint64_t bits = rng.bits(2, k);
+            int u = 0;
+            int v = 0;
+            if (family == GraphFamily::Uniform) {
+                // The first V - 1 draws are a random spanning tree.
+                if (k + 1 < V) {
+                    v = static_cast<int>(k) + 1;
+                    u = scaleBits32(bits >> 32, v);
+                } else {
+                    u = scaleBits32(bits >> 32, V);
+                    v = scaleBits32(bits & 0xFFFFFFFFULL, V);
+                }
+            } else if (family == GraphFamily::PowerLaw) {
+                u = GraphGenerator::pickCumulative(cumulative, bits >> 32);
+                v = GraphGenerator::pickCumulative(cumulative, bits & 0xFFFFFFFFULL);
+            } else {
+                std::tie(u, v) = GraphGenerator::rmatCell(bits, levels, GraphGenerator::RMAT_A,
+                                                          GraphGenerator::RMAT_B, GraphGenerator::RMAT_C);
+                if (u >= vertices || v >= vertices) continue;
+            }
+            if (u != v) emit(u, v, weight(k, 1.0, 100.0));
+        }
+    }
+};
+
+// One bucketed entry of the spill file: 20 bytes, no padding.
+#pragma pack(push, 4)
+struct SpillEntry {
+    int row;
+    int target;
+    int id;
+    double weight;
+};
+#pragma pack(pop)
+static_assert(sizeof(SpillEntry) == 20, "SpillEntry must stay unpadded");
+
+constexpr size_t SPILL_CHUNK = 1 << 20;
+
+bool writeFully(int fd, uint64_t offset, const void* data, size_t bytes) {
+    const char* cursor = static_cast<const char*>(data);
+    while (bytes > 0) {
+        ssize_t written = pwrite(fd, cursor, bytes, static_cast<off_t>(offset));
+        if (written <= 0) return false;
+        cursor += written;
+        offset += written;
+        bytes -= written;
+    }
+    return true;
+}
+
+bool readFully(int fd, uint64_t offset, void* data, size_t bytes) {
+    char* cursor = static_cast<char*>(data);
+    while (bytes > 0) {
+        ssize_t got = pread(fd, cursor, bytes, static_cast<off_t>(offset));
+        if (got <= 0) return false;
+        cursor += got;
+        offset += got;
+        bytes -= got;
+    }
+    return true;
+}
+
+void writeAt(int fd, uint64_t offset, const void* data, size_t bytes, const std::string& path) {
+    if (!writeFully(fd, offset, data, bytes)) {
+        close(fd);
+        throw std::runtime_error("Failed writing " + path);
+    }
+}
+}
+
+StreamGenerator::StreamGenerator(unsigned seed, int threads, size_t budgetBytes)
+    : rng(seed), numThreads(threads > 0 ? threads : defaultThreadCount()), memoryBudget(budgetBytes) {}
+
+StreamStats StreamGenerator::writeCSR(const std::string& path, GraphFamily family, int V, double density) {
+    Timer timer;
+    timer.start();
+    StreamStats stats;
+    EdgeSource source(rng, family, V, density);
+    const int n = source.vertices;
+    const size_t blocks = source.blocks();
+
+    std::vector<uint64_t> blockBase(blocks + 1, 0);
+    std::vector<uint64_t> offsets(static_cast<size_t>(n) + 1, 0);
+    {
+        std::vector<std::atomic<uint64_t>> degree(n);
+        parallelFor(numThreads, blocks, [&](int, size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                uint64_t count = 0;
+                source.emit(b, [&](int u, int v, double) {
+                    degree[u].fetch_add(1, std::memory_order_relaxed);
+                    degree[v].fetch_add(1, std::memory_order_relaxed);
+                    count++;
+                });
+                blockBase[b + 1] = count;
+            }
+        });
+        for (size_t b = 0; b < blocks; ++b) blockBase[b + 1] += blockBase[b];
+        for (int u = 0; u < n; ++u) offsets[u + 1] = offsets[u] + degree[u].load(std::memory_order_relaxed);
+    }
+    const uint64_t edges = blockBase[blocks];
+    if (edges > static_cast<uint64_t>(INT32_MAX)) {
+        throw std::runtime_error("Graph files store 32-bit edge ids; " + std::to_string(edges) + " edges is too many");
+    }
+    stats.vertices = n;
+    stats.edges = edges;
+
+    GraphFileHeader header = GraphFile::makeHeader(n, edges);
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0 || ftruncate(fd, static_cast<off_t>(header.fileSize)) != 0) {
+        if (fd >= 0) close(fd);
+        throw std::runtime_error("Cannot open " + path + " for writing");
+    }
+    writeAt(fd, 0, &header, sizeof(header), path);
+    writeAt(fd, header.offsetsOffset, offsets.data(), offsets.size() * sizeof(uint64_t), path);
+
+    const size_t entryBytes = sizeof(int) + sizeof(double) + sizeof(int);
+    const size_t rowBytes = sizeof(std::atomic<uint64_t>);
+    std::vector<int> windowStart(1, 0);
+    for (int lo = 0; lo < n;) {
+        int hi = lo + 1;
+        while (hi < n && (offsets[hi + 1] - offsets[lo]) * entryBytes + (hi + 1 - lo) * rowBytes <= memoryBudget) {
+            hi++;
+        }
+        windowStart.push_back(hi);
+        lo = hi;
+    }
+    const size_t windows = windowStart.size() - 1;
+
+    // With several windows, one generation pass buckets every entry into its
+    // window's region of an unlinked spill file (regions are laid out by the
+    // CSR offsets), so each window later reads back only its own entries.
+    int spillFd = -1;
+    const std::string spillPath = path + ".spill";
+    if (windows > 1) {
+        spillFd = open(spillPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+        if (spillFd < 0) {
+            close(fd);
+            throw std::runtime_error("Cannot create spill file " + spillPath);
+        }
+        unlink(spillPath.c_str());
+        std::vector<std::atomic<uint64_t>> spillCursor(windows);
+        for (size_t w = 0; w < windows; ++w) spillCursor[w].store(offsets[windowStart[w]], std::memory_order_relaxed);
+        // Every thread keeps one buffer per window; together they take at most half the budget.
+        const size_t bufferEntries = std::clamp<size_t>(
+            memoryBudget / (2 * static_cast<size_t>(numThreads) * windows * sizeof(SpillEntry)), 1, 8192);
+        std::atomic<bool> failed{false};
+        parallelFor(numThreads, blocks, [&](int, size_t begin, size_t end) {
+            std::vector<std::vector<SpillEntry>> buffers(windows);
+            auto flush = [&](size_t w) {
+                auto& buffer = buffers[w];
+                uint64_t at = spillCursor[w].fetch_add(buffer.size(), std::memory_order_relaxed);
+                if (!writeFully(spillFd, at * sizeof(SpillEntry), buffer.data(), buffer.size() * sizeof(SpillEntry))) {
+                    failed = true;
+                }
+                buffer.clear();
+            };
+            auto put = [&](int row, int target, double weight, uint64_t id) {
+                size_t w = std::upper_bound(windowStart.begin() + 1, windowStart.end(), row) - windowStart.begin() - 1;
+                auto& buffer = buffers[w];
+                if (buffer.empty()) buffer.reserve(bufferEntries);
+                buffer.push_back({row, target, static_cast<int>(id), weight});
+                if (buffer.size() == bufferEntries) flush(w);
+            };
+            for (size_t b = begin; b < end && !failed; ++b) {
+                uint64_t id = blockBase[b];
+                source.emit(b, [&](int u, int v, double weight) {
+                    put(u, v, weight, id);
+                    put(v, u, weight, id);
+                    id++;
+                });
+            }
+            for (size_t w = 0; w < windows; ++w) {
+                if (!buffers[w].empty()) flush(w);
+            }
+        });
+        if (failed) {
+            close(spillFd);
+            close(fd);
+            throw std::runtime_error("Failed writing spill file " + spillPath);
+        }
+        stats.spillBytes = 2 * edges * sizeof(SpillEntry);
+        stats.bufferBytes = static_cast<size_t>(numThreads) * windows * bufferEntries * sizeof(SpillEntry);
+    }
+
+    std::vector<std::vector<std::tuple<int, int, double>>> scratch(numThreads);
+    for (size_t w = 0; w < windows; ++w) {
+        const int lo = windowStart[w];
+        const int hi = windowStart[w + 1];
+        const uint64_t base = offsets[lo];
+        const size_t entries = offsets[hi] - base;
+        std::vector<int> targets(entries);
+        std::vector<double> weights(entries);
+        std::vector<int> edgeIds(entries);
+        std::vector<std::atomic<uint64_t>> cursor(hi - lo);
+        for (int u = lo; u < hi; ++u) cursor[u - lo].store(offsets[u] - base, std::memory_order_relaxed);
+        auto place = [&](int row, int target, double weight, int id) {
+            uint64_t slot = cursor[row - lo].fetch_add(1, std::memory_order_relaxed);
+            targets[slot] = target;
+            weights[slot] = weight;
+            edgeIds[slot] = id;
+        };
+        size_t chunkBytes = 0;
+
+        if (spillFd < 0) {
+            parallelFor(numThreads, blocks, [&](int, size_t begin, size_t end) {
+                for (size_t b = begin; b < end; ++b) {
+                    uint64_t id = blockBase[b];
+                    source.emit(b, [&](int u, int v, double weight) {
+                        place(u, v, weight, static_cast<int>(id));
+                        place(v, u, weight, static_cast<int>(id));
+                        id++;
+                    });
+                }
+            });
+        } else {
+            std::vector<SpillEntry> chunk(
+                std::min({entries, SPILL_CHUNK, std::max<size_t>(1, memoryBudget / 4 / sizeof(SpillEntry))}));
+            chunkBytes = chunk.size() * sizeof(SpillEntry);
+            for (size_t done = 0; done < entries; done += chunk.size()) {
+                size_t count = std::min(chunk.size(), entries - done);
+                if (!readFully(spillFd, (base + done) * sizeof(SpillEntry), chunk.data(), count * sizeof(SpillEntry))) {
+                    close(spillFd);
+                    close(fd);
+                    throw std::runtime_error("Failed reading spill file " + spillPath);
+                }
+                parallelFor(numThreads, count, [&](int, size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i) {
+                        place(chunk[i].row, chunk[i].target, chunk[i].weight, chunk[i].id);
+                    }
+                });
+            }
+        }
+        // Entries land in any order; sorting each row by edge id makes the file deterministic.
+        parallelFor(numThreads, hi - lo, [&](int t, size_t begin, size_t end) {
+            auto& row = scratch[t];
+            for (size_t r = begin; r < end; ++r) {
+                size_t first = offsets[lo + r] - base;
+                size_t last = offsets[lo + r + 1] - base;
+                row.clear();
+                for (size_t k = first; k < last; ++k) row.emplace_back(edgeIds[k], targets[k], weights[k]);
+                std::sort(row.begin(), row.end());
+                for (size_t k = first; k < last; ++k) {
+                    std::tie(edgeIds[k], targets[k], weights[k]) = row[k - first];
+                }
+            }
+        });
+
+        writeAt(fd, header.targetsOffset + base * sizeof(int32_t), targets.data(), entries * sizeof(int32_t), path);
+        writeAt(fd, header.weightsOffset + base * sizeof(double), weights.data(), entries * sizeof(double), path);
+        writeAt(fd, header.edgeIdsOffset + base * sizeof(int32_t), edgeIds.data(), entries * sizeof(int32_t), path);
+        stats.windows++;
+        stats.bufferBytes = std::max(stats.bufferBytes, entries * entryBytes + (hi - lo) * rowBytes + chunkBytes);
+    }
+    if (spillFd >= 0) close(spillFd);
+    close(fd);
+    stats.milliseconds = timer.elapsedMilliseconds();
+    return stats;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef STREAM_GENERATOR_HPP
+#define STREAM_GENERATOR_HPP
+
+#include "graph_generator.hpp"
+#include "../utils/random.hpp"
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+struct StreamStats {
+    uint64_t vertices;
+    uint64_t edges;
+    int windows;
+    size_t bufferBytes;
+    uint64_t spillBytes;
+    double milliseconds;
+
+    StreamStats() : vertices(0), edges(0), windows(0), bufferBytes(0), spillBytes(0), milliseconds(0.0) {}
+};
+
+// Writes generated graphs straight into a GraphFile without building a Graph.
+// Edges come in fixed blocks, each a pure function of (seed, block), so any
+// block can be regenerated on demand. One pass counts degrees, which fixes
+// the CSR offsets and splits the rows into windows that fit the memory
+// budget. If everything fits, a second pass scatters the entries straight
+// into place. Otherwise the second pass buckets every entry (20 bytes) into
+// its window's region of a temporary spill file next to the output, and each
+// window then reads back only its own region. Either way the edges are
+// generated twice, whatever the number of windows. Each row is ordered by
+// edge id before it is written. RAM is O(V) plus the budget (plus a read
+// chunk of a quarter budget when spilling), and the file is identical for a
+// seed whatever the thread count or budget.
+//
+// Graph files store 32-bit edge ids, so one stream holds at most INT32_MAX
+// (about 2.1 billion) edges; writeCSR throws before writing anything larger.
+//
+// Supports Uniform (sparse for density >= 1, dense otherwise), Grid, PowerLaw
+// and RMAT. Unlike GraphGenerator, repeated pairs are not removed and the
+// dense family keeps each pair independently, so edge counts are expected
+// rather than exact values. Self-loops are never emitted.
+class StreamGenerator {
+private:
+    CounterRng rng;
+    int numThreads;
+    size_t memoryBudget;
+
+public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 256ULL << 20;
+    static constexpr size_t BLOCK = 1 << 16;
+
+    StreamGenerator(unsigned seed, int threads = 0, size_t budgetBytes = DEFAULT_MEMORY_BUDGET);
+
+    StreamStats writeCSR(const std::string& path, GraphFamily family, int V, double density);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "graph_file.hpp"
+#include <fstream>
+#include <stdexcept>
+#include <cstring>
+#include <memory>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(sizeof(GraphFileHeader) == 128, "GraphFileHeader must stay 128 bytes");
+static_assert(sizeof(size_t) == sizeof(uint64_t), "CSR offsets are stored as uint64");
+
+namespace {
+const char MAGIC[8] = {'M', 'S', 'T', 'C', 'S', 'R', '\0', '\0'};
+
+uint64_t alignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+}
+
+GraphFileHeader GraphFile::makeHeader(uint64_t numVertices, uint64_t numEdges) {
+    GraphFileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.headerSize = sizeof(GraphFileHeader);
+    header.numVertices = numVertices;
+    header.numEdges = numEdges;
+    header.numEntries = 2 * numEdges;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+
+    header.offsetsOffset = alignUp(sizeof(GraphFileHeader), SECTION_ALIGNMENT);
+    header.targetsOffset = alignUp(header.offsetsOffset + (header.numVertices + 1) * sizeof(uint64_t),
+                                   SECTION_ALIGNMENT);
+    header.weightsOffset = alignUp(header.targetsOffset + header.numEntries * sizeof(int32_t),
+                                   SECTION_ALIGNMENT);
+    header.edgeIdsOffset = alignUp(header.weightsOffset + header.numEntries * sizeof(double),
+                                   SECTION_ALIGNMENT);
+    header.fileSize = header.edgeIdsOffset + header.numEntries * sizeof(int32_t);
+    return header;
+}
+
+void GraphFile::write(const std::string& path, const CSRGraph& graph) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("Cannot open " + path + " for writing");
+    }
+
+    GraphFileHeader header = makeHeader(graph.getVertices(), graph.getEdges());
+    uint64_t position = 0;
+    auto writeSection = [&](uint64_t offset, const void* data, size_t bytes) {
+        static const char padding[SECTION_ALIGNMENT] = {};
+        out.write(padding, offset - position);
+        out.write(static_cast<const char*>(data), bytes);
+        position = offset + bytes;
+    };
+
+    writeSection(0, &header, sizeof(header));
+    writeSection(header.offsetsOffset, graph.getOffsets(), (header.numVertices + 1) * sizeof(uint64_t));
+    writeSection(header.targetsOffset, graph.getTargets(), header.numEntries * sizeof(int32_t));
+    writeSection(header.weightsOffset, graph.getWeights(), header.numEntries * sizeof(double));
+    writeSection(header.edgeIdsOffset, graph.getEdgeIds(), header.numEntries * sizeof(int32_t));
+
+    if (!out) {
+        throw std::runtime_error("Failed writing " + path);
+    }
+}
+
+void GraphFile::validateHeader(const GraphFileHeader& header, uint64_t actualSize, const std::string& path) {
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error(path + " is not an MST graph file");
+    }
+    if (header.byteOrderMark != BYTE_ORDER_MARK) {
+        throw std::runtime_error(path + " was written with a different byte order");
+    }
+    if (header.version != VERSION || header.headerSize != sizeof(GraphFileHeader)) {
+        throw std::runtime_error(path + " has unsupported graph file version " +
+                                 std::to_string(header.version));
+    }
+    if (header.numVertices > static_cast<uint64_t>(INT32_MAX) ||
+        header.numEdges > static_cast<uint64_t>(INT32_MAX) ||
+        header.numEntries != 2 * header.numEdges ||
+        header.fileSize != actualSize ||
+        header.offsetsOffset % SECTION_ALIGNMENT != 0 ||
+        header.targetsOffset % SECTION_ALIGNMENT != 0 ||
+        header.weightsOffset % SECTION_ALIGNMENT != 0 ||
+        header.edgeIdsOffset % SECTION_ALIGNMENT != 0 ||
+        header.offsetsOffset < header.headerSize ||
+        header.targetsOffset < header.offsetsOffset + (header.numVertices + 1) * sizeof(uint64_t) ||
+        header.weightsOffset < header.targetsOffset + header.numEntries * sizeof(int32_t) ||
+        header.edgeIdsOffset < header.weightsOffset + header.numEntries * sizeof(double) ||
+        header.edgeIdsOffset + header.numEntries * sizeof(int32_t) > actualSize) {
+        throw std::runtime_error(path + " has an inconsistent graph file header");
+    }
+}
+
+GraphFileHeader GraphFile::readHeader(const std::string& path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    uint64_t size = static_cast<uint64_t>(in.tellg());
+    GraphFileHeader header;
+    in.seekg(0);
+    if (size < sizeof(header) || !in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error(path + " is too small to be an MST graph file");
+    }
+    validateHeader(header, size, path);
+    return header;
+}
+
+void GraphFile::validateSections(const CSRGraph& graph, const std::string& path) {
+    int V = graph.getVertices();
+    size_t entries = graph.getEntries();
+    const size_t* offsets = graph.getOffsets();
+    for (int u = 0; u < V; ++u) {
+        if (offsets[u] > offsets[u + 1] || offsets[u + 1] > entries) {
+            throw std::runtime_error(path + " has corrupt CSR offsets at vertex " + std::to_string(u));
+        }
+    }
+    const int* targets = graph.getTargets();
+    const int* edgeIds = graph.getEdgeIds();
+    int64_t numEdges = static_cast<int64_t>(graph.getEdges());
+    for (size_t k = 0; k < entries; ++k) {
+        if (targets[k] < 0 || targets[k] >= V) {
+            throw std::runtime_error(path + " has an out-of-range target at entry " + std::to_string(k));
+        }
+        if (edgeIds[k] < 0 || edgeIds[k] >= numEdges) {
+            throw std::runtime_error(path + " has an out-of-range edge id at entry " + std::to_string(k));
+        }
+    }
+}
+
+CSRGraph GraphFile::map(const std::string& path, bool validate) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(GraphFileHeader)) {
+        close(fd);
+        throw std::runtime_error(path + " is too small to be an MST graph file");
+    }
+    size_t length = static_cast<size_t>(st.st_size);
+    void* address = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (address == MAP_FAILED) {
+        throw std::runtime_error("Cannot mmap " + path);
+    }
+    std::shared_ptr<const void> mapping(address, [length](const void* p) {
+        munmap(const_cast<void*>(p), length);
+    });
+
+    const char* base = static_cast<const char*>(address);
+    GraphFileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    validateHeader(header, length, path);
+
+    const size_t* offsets = reinterpret_cast<const size_t*>(base + header.offsetsOffset);
+    if (offsets[0] != 0 || offsets[header.numVertices] != header.numEntries) {
+        throw std::runtime_error(path + " has corrupt CSR offsets");
+    }
+    CSRGraph graph(static_cast<int>(header.numVertices), header.numEdges, offsets,
+                   reinterpret_cast<const int*>(base + header.targetsOffset),
+                   reinterpret_cast<const double*>(base + header.weightsOffset),
+                   reinterpret_cast<const int*>(base + header.edgeIdsOffset),
+                   mapping);
+    if (validate) validateSections(graph, path);
+    return graph;
+}
\ No newline at end of file
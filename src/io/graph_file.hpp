@@ -0,0 +1,55 @@
+#ifndef GRAPH_FILE_HPP
+#define GRAPH_FILE_HPP
+
+#include "../data_structures/csr_graph.hpp"
+#include <cstdint>
+#include <string>
+
+// On-disk CSR layout (little-endian, version 1):
+//   GraphFileHeader (128 bytes)
+//   offsets  : uint64[numVertices + 1]
+//   targets  : int32[numEntries]
+//   weights  : float64[numEntries]
+//   edgeIds  : int32[numEntries]
+// Every section starts on a 64-byte boundary so the mapped arrays can be used in place.
+struct GraphFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t headerSize;
+    uint64_t numVertices;
+    uint64_t numEdges;
+    uint64_t numEntries;
+    uint64_t offsetsOffset;
+    uint64_t targetsOffset;
+    uint64_t weightsOffset;
+    uint64_t edgeIdsOffset;
+    uint64_t fileSize;
+    uint32_t byteOrderMark;
+    uint8_t reserved[44];
+};
+
+class GraphFile {
+public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static constexpr uint64_t SECTION_ALIGNMENT = 64;
+
+    static void write(const std::string& path, const CSRGraph& graph);
+    // Maps the file read-only and returns a CSRGraph whose arrays point into the
+    // mapping; nothing is parsed or copied, and the pages are shared with every
+    // other process mapping the same file. With validate, one O(V + E) pass
+    // checks that offsets are monotone and every target and edge id is in
+    // range, so a corrupt file is rejected instead of read out of bounds;
+    // skip it only for files this process wrote or already checked.
+    static CSRGraph map(const std::string& path, bool validate = true);
+    static GraphFileHeader readHeader(const std::string& path);
+    // Section layout for a graph of this size, for writers that fill the
+    // sections themselves.
+    static GraphFileHeader makeHeader(uint64_t numVertices, uint64_t numEdges);
+
+private:
+    static void validateHeader(const GraphFileHeader& header, uint64_t actualSize, const std::string& path);
+    static void validateSections(const CSRGraph& graph, const std::string& path);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,430 @@
+#include "graph_loader.hpp"
+#include "graph_file.hpp"
+#include "../utils/parallel.hpp"
+#include "../utils/timer.hpp"
+#include "../utils/random.hpp"
+#include <fstream>
+#include <stdexcept>
+#include <charconv>
+#include <cstring>
+#include <cstdint>
+
+namespace {
+
+struct FormatState {
+    GraphFormat format;
+    int vertices = 0;
+    bool edgeWeights = true;
+    bool vertexSizes = false;
+    int vertexWeights = 0;
+    bool dropReverseArcs = true;
+    unsigned weightSeed = 1;
+};
+
+// Deterministic stand-in weight in [1, 100) for unweighted inputs, symmetric in (u, v).
+double missingWeight(int u, int v, unsigned seed) {
+    uint64_t x = (static_cast<uint64_t>(std::min(u, v)) << 32) | static_cast<uint32_t>(std::max(u, v));
+    x ^= static_cast<uint64_t>(seed) * GOLDEN_GAMMA;
+    return 1.0 + 99.0 * toUnitInterval(mix64(x));
+}
+
+const char* skipBlanks(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    return p;
+}
+
+bool parseInt(const char*& p, const char* end, long long& value) {
+    p = skipBlanks(p, end);
+    auto parsed = std::from_chars(p, end, value);
+    if (parsed.ec != std::errc()) return false;
+    p = parsed.ptr;
+    return true;
+}
+
+bool parseDouble(const char*& p, const char* end, double& value) {
+    p = skipBlanks(p, end);
+    auto parsed = std::from_chars(p, end, value);
+    if (parsed.ec != std::errc()) return false;
+    p = parsed.ptr;
+    return true;
+}
+
+std::runtime_error malformed(const char* begin, const char* end) {
+    return std::runtime_error("Malformed line: " + std::string(begin, std::min<size_t>(end - begin, 80)));
+}
+
+int checkedVertex(long long id, const FormatState& state, const char* begin, const char* end) {
+    if (id < 0 || id >= state.vertices) {
+        throw malformed(begin, end);
+    }
+    return static_cast<int>(id);
+}
+
+// Each parser handles one line [begin, end) without its trailing newline.
+void parseDimacsLine(const char* begin, const char* end, const FormatState& state,
+                     std::vector<BuilderEdge>& out) {
+    const char* p = skipBlanks(begin, end);
+    if (p == end || *p == 'c' || *p == 'p') return;
+    char kind = *p++;
+    if (kind != 'a' && kind != 'e') throw malformed(begin, end);
+
+    long long u, v;
+    if (!parseInt(p, end, u) || !parseInt(p, end, v)) throw malformed(begin, end);
+    int from = checkedVertex(u - 1, state, begin, end);
+    int to = checkedVertex(v - 1, state, begin, end);
+    if (kind == 'a' && state.dropReverseArcs && from > to) return;
+
+    double weight;
+    if (!parseDouble(p, end, weight)) {
+        if (kind == 'a') throw malformed(begin, end);
+        weight = missingWeight(from, to, state.weightSeed);
+    }
+    out.push_back({from, to, weight});
+}
+
+void parseSnapLine(const char* begin, const char* end, const FormatState& state,
+                   std::vector<BuilderEdge>& out, int& maxVertex) {
+    const char* p = skipBlanks(begin, end);
+    if (p == end || *p == '#' || *p == '%') return;
+
+    long long u, v;
+    if (!parseInt(p, end, u) || !parseInt(p, end, v) || u < 0 || v < 0 || u > INT32_MAX - 1 || v > INT32_MAX - 1) {
+        throw malformed(begin, end);
+    }
+    int from = static_cast<int>(u);
+    int to = static_cast<int>(v);
+    double weight;
+    if (!parseDouble(p, end, weight)) {
+        weight = missingWeight(from, to, state.weightSeed);
+    }
+    maxVertex = std::max(maxVertex, std::max(from, to));
+    out.push_back({from, to, weight});
+}
+
+void parseMetisLine(const char* begin, const char* end, int vertex, const FormatState& state,
+                    std::vector<BuilderEdge>& out) {
+    const char* p = begin;
+    long long skipped;
+    if (state.vertexSizes && !parseInt(p, end, skipped)) throw malformed(begin, end);
+    for (int i = 0; i < state.vertexWeights; ++i) {
+        if (!parseInt(p, end, skipped)) throw malformed(begin, end);
+    }
+
+    long long neighbor;
+    while (parseInt(p, end, neighbor)) {
+        int to = checkedVertex(neighbor - 1, state, begin, end);
+        double weight;
+        if (state.edgeWeights) {
+            if (!parseDouble(p, end, weight)) throw malformed(begin, end);
+        } else {
+            weight = missingWeight(vertex, to, state.weightSeed);
+        }
+        if (vertex < to) {
+            out.push_back({vertex, to, weight});
+        }
+    }
+    if (skipBlanks(p, end) != end) throw malformed(begin, end);
+}
+
+bool isMetisComment(const char* begin, const char* end) {
+    return begin < end && *begin == '%';
+}
+
+// Consumes lines up to and including the header; returns the offset just past it,
+// or npos if the window holds no header yet.
+size_t parseHeader(const char* data, size_t size, FormatState& state) {
+    size_t pos = 0;
+    while (pos < size) {
+        const char* lineBegin = data + pos;
+        const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', size - pos));
+        size_t next = lineEnd - data + 1;
+        const char* p = skipBlanks(lineBegin, lineEnd);
+
+        if (state.format == GraphFormat::DIMACS) {
+            if (p == lineEnd || *p == 'c') {
+                pos = next;
+                continue;
+            }
+            if (*p != 'p') throw std::runtime_error("DIMACS edge data before the 'p' header line");
+            ++p;
+            p = skipBlanks(p, lineEnd);
+            while (p < lineEnd && *p != ' ' && *p != '\t') ++p;
+            long long n, m;
+            if (!parseInt(p, lineEnd, n) || !parseInt(p, lineEnd, m) || n < 0 || n > INT32_MAX) {
+                throw malformed(lineBegin, lineEnd);
+            }
+            state.vertices = static_cast<int>(n);
+            return next;
+        }
+
+        if (isMetisComment(lineBegin, lineEnd)) {
+            pos = next;
+            continue;
+        }
+        long long n, m, fmt = 0, ncon = 0;
+        if (!parseInt(p, lineEnd, n) || !parseInt(p, lineEnd, m) || n < 0 || n > INT32_MAX) {
+            throw malformed(lineBegin, lineEnd);
+        }
+        if (parseInt(p, lineEnd, fmt)) {
+            parseInt(p, lineEnd, ncon);
+        }
+        state.vertices = static_cast<int>(n);
+        state.edgeWeights = fmt % 10 == 1;
+        state.vertexWeights = (fmt / 10) % 10 == 1 ? static_cast<int>(std::max(1LL, ncon)) : 0;
+        state.vertexSizes = (fmt / 100) % 10 == 1;
+        return next;
+    }
+    return std::string::npos;
+}
+
+// Splits [0, size) into slices that start and end on line boundaries.
+std::vector<size_t> sliceBoundaries(const char* data, size_t size, int slices) {
+    std::vector<size_t> bounds(slices + 1, size);
+    bounds[0] = 0;
+    for (int t = 1; t < slices; ++t) {
+        size_t pos = std::max(bounds[t - 1], size / slices * t);
+        while (pos < size && pos > 0 && data[pos - 1] != '\n') ++pos;
+        bounds[t] = pos;
+    }
+    return bounds;
+}
+
+template <typename Func>
+void forEachLine(const char* begin, const char* end, Func&& fn) {
+    while (begin < end) {
+        const char* lineEnd = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+        fn(begin, lineEnd);
+        begin = lineEnd + 1;
+    }
+}
+
+}
+
+GraphFormat GraphLoader::detectFormat(const std::string& path) {
+    auto endsWith = [&](const std::string& suffix) {
+        return path.size() >= suffix.size() && path.compare(path.size() - suffix.size(), suffix.size(), suffix) == 0;
+    };
+    if (endsWith(".gr") || endsWith(".dimacs") || endsWith(".col")) return GraphFormat::DIMACS;
+    if (endsWith(".graph") || endsWith(".metis")) return GraphFormat::METIS;
+    if (endsWith(".csrg")) return GraphFormat::BINARY;
+    return GraphFormat::SNAP;
+}
+
+std::string GraphLoader::formatName(GraphFormat format) {
+    switch (format) {
+        case GraphFormat::DIMACS: return "DIMACS";
+        case GraphFormat::SNAP: return "SNAP";
+        case GraphFormat::METIS: return "METIS";
+        case GraphFormat::BINARY: return "BINARY";
+    }
+    return "UNKNOWN";
+}
+
+std::unique_ptr<GraphBuilder> GraphLoader::parse(const std::string& path, GraphFormat format,
+                                                 const LoadOptions& options, LoadStats& stats) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("Cannot open " + path);
+    }
+
+    int threads = options.threads > 0 ? options.threads : defaultThreadCount();
+    FormatState state;
+    state.format = format;
+    state.dropReverseArcs = options.dropReverseArcs;
+    state.weightSeed = options.weightSeed;
+
+    std::unique_ptr<GraphBuilder> builder;
+    if (format == GraphFormat::SNAP) {
+        builder = std::make_unique<GraphBuilder>(0, 0, false, threads);
+    }
+    long long nextVertex = 0;
+
+    std::vector<char> buffer(std::max<size_t>(options.chunkBytes, 4096));
+    size_t carry = 0;
+    bool eof = false;
+    while (!eof) {
+        if (carry == buffer.size()) {
+            buffer.resize(buffer.size() * 2);
+        }
+        in.read(buffer.data() + carry, buffer.size() - carry);
+        size_t got = static_cast<size_t>(in.gcount());
+        stats.bytes += got;
+        eof = !in;
+        size_t filled = carry + got;
+
+        size_t end;
+        if (eof) {
+            if (filled == 0) break;
+            if (buffer[filled - 1] != '\n') {
+                if (filled == buffer.size()) buffer.push_back('\n');
+                else buffer[filled] = '\n';
+                filled++;
+            }
+            end = filled;
+        } else {
+            const char* data = buffer.data();
+            size_t last = filled;
+            while (last > 0 && data[last - 1] != '\n') --last;
+            if (last == 0) {
+                carry = filled;
+                continue;
+            }
+            end = last;
+        }
+
+        const char* data = buffer.data();
+        size_t start = 0;
+        if (!builder) {
+            start = parseHeader(data, end, state);
+            if (start == std::string::npos) {
+                if (eof) throw std::runtime_error(path + " has no " + formatName(format) + " header");
+                start = end;
+            } else {
+                builder = std::make_unique<GraphBuilder>(state.vertices, 0, false, threads);
+            }
+        }
+
+        if (builder && start < end) {
+            const char* window = data + start;
+            size_t size = end - start;
+            std::vector<size_t> bounds = sliceBoundaries(window, size, threads);
+            std::vector<std::vector<BuilderEdge>> local(threads);
+            std::vector<int> maxVertex(threads, -1);
+            std::vector<std::string> errors(threads);
+
+            std::vector<long long> firstVertex(threads + 1, 0);
+            if (format == GraphFormat::METIS) {
+                parallelFor(threads, threads, [&](int, size_t begin, size_t endSlice) {
+                    for (size_t t = begin; t < endSlice; ++t) {
+                        long long lines = 0;
+                        forEachLine(window + bounds[t], window + bounds[t + 1], [&](const char* b, const char* e) {
+                            if (!isMetisComment(b, e)) lines++;
+                        });
+                        firstVertex[t + 1] = lines;
+                    }
+                });
+                firstVertex[0] = nextVertex;
+                for (int t = 0; t < threads; ++t) {
+                    firstVertex[t + 1] += firstVertex[t];
+                }
+                nextVertex = firstVertex[threads];
+            }
+
+            parallelFor(threads, threads, [&](int, size_t begin, size_t endSlice) {
+                for (size_t t = begin; t < endSlice; ++t) {
+                    try {
+                        auto& out = local[t];
+                        long long vertex = firstVertex[t];
+                        forEachLine(window + bounds[t], window + bounds[t + 1], [&](const char* b, const char* e) {
+                            switch (format) {
+                                case GraphFormat::DIMACS:
+                                    parseDimacsLine(b, e, state, out);
+                                    break;
+                                case GraphFormat::SNAP:
+                                    parseSnapLine(b, e, state, out, maxVertex[t]);
+                                    break;
+                                case GraphFormat::METIS:
+                                    if (isMetisComment(b, e)) break;
+                                    if (vertex >= state.vertices) {
+                                        if (skipBlanks(b, e) == e) break;
+                                        throw malformed(b, e);
+                                    }
+                                    parseMetisLine(b, e, static_cast<int>(vertex++), state, out);
+                                    break;
+                                case GraphFormat::BINARY:
+                                    break;
+                            }
+                        });
+                    } catch (const std::exception& e) {
+                        errors[t] = e.what();
+                    }
+                }
+            });
+
+            for (int t = 0; t < threads; ++t) {
+                if (!errors[t].empty()) {
+                    throw std::runtime_error(path + ": " + errors[t]);
+                }
+                if (maxVertex[t] >= builder->getVertices()) {
+                    builder->growVertices(maxVertex[t] + 1);
+                }
+                builder->addEdges(std::move(local[t]));
+            }
+        }
+
+        carry = filled - end;
+        std::memmove(buffer.data(), buffer.data() + end, carry);
+    }
+
+    if (!builder) {
+        throw std::runtime_error(path + " has no " + formatName(format) + " header");
+    }
+    return builder;
+}
+
+Graph GraphLoader::load(const std::string& path, GraphFormat format,
+                        const LoadOptions& options, LoadStats* stats) {
+    LoadStats local;
+    LoadStats& s = stats ? *stats : local;
+    s = LoadStats();
+    if (format == GraphFormat::BINARY) {
+        CSRGraph csr = loadCSR(path, format, options, &s);
+        Timer timer;
+        timer.start();
+        GraphBuilder builder(csr.getVertices(), csr.getEdges(), false, options.threads);
+        std::vector<BuilderEdge> edges;
+        edges.reserve(csr.getEdges());
+        for (const auto& edge : csr.getEdgeListWithIds()) {
+            edges.push_back({std::get<0>(edge), std::get<1>(edge), std::get<2>(edge)});
+        }
+        builder.addEdges(std::move(edges));
+        Graph graph = builder.build();
+        timer.stop();
+        s.buildMilliseconds += timer.elapsedMilliseconds();
+        return graph;
+    }
+
+    Timer timer;
+    timer.start();
+    std::unique_ptr<GraphBuilder> builder = parse(path, format, options, s);
+    timer.stop();
+    s.parseMilliseconds = timer.elapsedMilliseconds();
+    s.edges = builder->getEdges();
+    s.vertices = builder->getVertices();
+
+    timer.start();
+    Graph graph = builder->build();
+    timer.stop();
+    s.buildMilliseconds = timer.elapsedMilliseconds();
+    return graph;
+}
+
+CSRGraph GraphLoader::loadCSR(const std::string& path, GraphFormat format,
+                              const LoadOptions& options, LoadStats* stats) {
+    LoadStats local;
+    LoadStats& s = stats ? *stats : local;
+    s = LoadStats();
+    Timer timer;
+    timer.start();
+    if (format == GraphFormat::BINARY) {
+        CSRGraph graph = GraphFile::map(path, options.validateBinary);
+        timer.stop();
+        s.parseMilliseconds = timer.elapsedMilliseconds();
+        s.bytes = GraphFile::readHeader(path).fileSize;
+        s.edges = graph.getEdges();
+        s.vertices = graph.getVertices();
+        return graph;
+    }
+
+    std::unique_ptr<GraphBuilder> builder = parse(path, format, options, s);
+    timer.stop();
+    s.parseMilliseconds = timer.elapsedMilliseconds();
+    s.edges = builder->getEdges();
+    s.vertices = builder->getVertices();
+
+    timer.start();
+    CSRGraph graph = builder->buildCSR();
+    timer.stop();
+    s.buildMilliseconds = timer.elapsedMilliseconds();
+    return graph;
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#ifndef GRAPH_LOADER_HPP
+#define GRAPH_LOADER_HPP
+
+#include "../data_structures/graph.hpp"
+#include "../data_structures/csr_graph.hpp"
+#include "../data_structures/graph_builder.hpp"
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <memory>
+
+enum class GraphFormat {
+    DIMACS,   // "p sp n m" header, "a u v w" arcs or "e u v [w]" edges, 1-based
+    SNAP,     // "u v [w]" per line, '#' comments, 0-based ids
+    METIS,    // "n m [fmt]" header, line i lists the neighbours of vertex i, 1-based
+    BINARY    // GraphFile CSR format
+};
+
+struct LoadOptions {
+    int threads = 0;
+    size_t chunkBytes = 64 << 20;
+    // DIMACS shortest-path files list every undirected edge as two arcs; keep only u < v.
+    bool dropReverseArcs = true;
+    // Seed for the deterministic weights assigned to unweighted edges.
+    unsigned weightSeed = 1;
+    // Check offsets, targets and edge ids of mapped binary files (see GraphFile::map).
+    bool validateBinary = true;
+};
+
+struct LoadStats {
+    size_t bytes = 0;
+    size_t edges = 0;
+    int vertices = 0;
+    double parseMilliseconds = 0.0;
+    double buildMilliseconds = 0.0;
+
+    double throughputMBps() const {
+        return parseMilliseconds > 0 ? (bytes / (1024.0 * 1024.0)) / (parseMilliseconds / 1000.0) : 0.0;
+    }
+};
+
+// Streams a text graph file through a fixed-size window. Each window is cut on
+// line boundaries into one slice per thread, the slices are parsed concurrently
+// into thread-local edge buffers, and the buffers are merged into a GraphBuilder.
+class GraphLoader {
+public:
+    static GraphFormat detectFormat(const std::string& path);
+    static std::string formatName(GraphFormat format);
+
+    static Graph load(const std::string& path, GraphFormat format,
+                      const LoadOptions& options = LoadOptions(), LoadStats* stats = nullptr);
+    static CSRGraph loadCSR(const std::string& path, GraphFormat format,
+                            const LoadOptions& options = LoadOptions(), LoadStats* stats = nullptr);
+
+private:
+    static std::unique_ptr<GraphBuilder> parse(const std::string& path, GraphFormat format,
+                              const LoadOptions& options, LoadStats& stats);
+};
+
+#endif
\ No newline at end of file
@@ -1,12 +1,45 @@
 #include "../data_structures/graph.hpp"
+#include "../data_structures/csr_graph.hpp"
+#include "../data_structures/graph_builder.hpp"
+#include "../data_structures/concurrent_union_find.hpp"
+#include "../data_structures/indexed_dary_heap.hpp"
+#include "../data_structures/forest_path_max.hpp"
 #include "../algorithms/kruskal.hpp"
 #include "../algorithms/prim.hpp"
+#include "../algorithms/prim_dense.hpp"
 #include "../algorithms/kkt.hpp"  
+#include "../algorithms/kkt_parallel.hpp"
 #include "../algorithms/boruvka_parallel.hpp"  
+#include "../algorithms/edge_sort.hpp"
+#include "../algorithms/edge_views.hpp"
+#include "../algorithms/filter_kruskal.hpp"
+#include "../algorithms/verifier.hpp"
+#include "../algorithms/algorithm_factory.hpp"
 #include "../generators/graph_generator.hpp"
+#include "../generators/stream_generator.hpp"
+#include "../io/graph_file.hpp"
+#include "../io/graph_loader.hpp"
+#include "../utils/thread_pool.hpp"
+#include "../utils/work_stealing.hpp"
+#include "../utils/arena.hpp"
+#include "../utils/random.hpp"
+#include "../utils/statistics.hpp"
+#include "../utils/allocation_tracker.hpp"
+#include "../utils/memory_monitor.hpp"
 #include <iostream>
 #include <cassert>
 #include <cmath>
+#include <thread>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <iomanip>
+#include <atomic>
+#include <random>
+#include <limits>
 
 void testGraphBasic() {
     std::cout << "Testing..." << std::endl;
@@ -32,9 +65,48 @@ void testUnionFind() {
     assert(uf.connected(0, 1));
     uf.unite(1, 2);
     assert(uf.connected(0, 2));
+
+    UnionFind<UnionBySize, PathHalving, int64_t> sized(6);
+    UnionFind<UnionByIndex, PathSplitting, int32_t> indexed(6);
+    for (int i = 0; i < 5; i += 2) {
+        assert(sized.unite(i, i + 1));
+        assert(indexed.unite(i, i + 1));
+    }
+    assert(sized.unite(1, 3) && indexed.unite(1, 3));
+    assert(!sized.unite(0, 2) && !indexed.unite(0, 2));
+    assert(sized.getComponents() == 2 && indexed.getComponents() == 2);
+    assert(sized.connected(0, 3) && !indexed.connected(3, 4));
     std::cout << "Union-Find passed" << std::endl;
 }
 
+void testConcurrentUnionFind() {
+    GraphGenerator generator(3);
+    Graph graph = generator.generateSparseGraph(2000, 4.0);
+    const auto& edges = graph.getEdgeList();
+
+    ConcurrentUnionFind cuf(2000);
+    std::atomic<int> merges(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            for (size_t i = t; i < edges.size(); i += 4) {
+                if (cuf.unite(std::get<0>(edges[i]), std::get<1>(edges[i]))) {
+                    merges++;
+                }
+                cuf.find(std::get<1>(edges[(i * 7) % edges.size()]));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assert(merges == 1999);
+    assert(cuf.getComponents() == 1);
+    assert(cuf.connected(0, 1999));
+    assert(!cuf.unite(5, 17));
+    std::cout << "Concurrent Union-Find passed" << std::endl;
+}
+
 void testKruskalSmall() {
     Graph graph(4, false);
     graph.addEdge(0, 1, 1.0);
@@ -49,6 +121,66 @@ void testKruskalSmall() {
     std::cout << "Kruskal small test passed" << std::endl;
 }
 
+void testRadixEdgeSort() {
+    std::vector<double> weights = {3.5, -1.0, 0.0, 100.0, -0.0, 2.25, -7.5, 3.5, 1e-300, -1e300};
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+    for (int i = 0; i < 20000; ++i) {
+        weights.push_back(dist(rng));
+    }
+    std::vector<uint32_t> order = EdgeSorter::sortByWeight(weights.size(), [&](size_t i) { return weights[i]; }, 3);
+    assert(order.size() == weights.size());
+    for (size_t i = 1; i < order.size(); ++i) {
+        assert(weights[order[i - 1]] <= weights[order[i]]);
+        if (weights[order[i - 1]] == weights[order[i]] && weightToKey(weights[order[i - 1]]) == weightToKey(weights[order[i]])) {
+            assert(order[i - 1] < order[i]);
+        }
+    }
+
+    GraphGenerator generator(21);
+    Graph graph = generator.generateDenseGraph(300, 0.4);
+    Kruskal comparisonSort(1, graph.getEdges() + 1);
+    Kruskal radixSort(3, 0);
+    MSTResult expected = comparisonSort.solve(graph);
+    MSTResult radix = radixSort.solve(graph);
+    assert(radix.metrics.at("radix_sort") == 1.0 && expected.metrics.at("radix_sort") == 0.0);
+    assert(std::abs(radix.totalWeight - expected.totalWeight) < 1e-9);
+    std::cout << "Radix edge sort test passed" << std::endl;
+}
+
+void testFilterKruskal() {
+    GraphGenerator generator(33);
+    Graph dense = generator.generateDenseGraph(400, 0.5);
+    Graph sparse = generator.generateSparseGraph(3000, 6.0);
+    Kruskal kruskal;
+    FilterKruskal filterKruskal(3, 64, 256);
+    for (const Graph* graph : {&dense, &sparse}) {
+        MSTResult expected = kruskal.solve(*graph);
+        MSTResult result = filterKruskal.solve(*graph);
+        assert(result.edges.size() == expected.edges.size());
+        assert(std::abs(result.totalWeight - expected.totalWeight) < 1e-6);
+        assert(std::abs(filterKruskal.solve(CSRGraph(*graph)).totalWeight - expected.totalWeight) < 1e-6);
+    }
+    MSTResult denseResult = filterKruskal.solve(dense);
+    assert(denseResult.metrics.at("filtered_edges") > 0);
+    assert(denseResult.metrics.at("sorted_edges") < dense.getEdges());
+
+    // Few distinct weights drive the parallel partition through its tie fallback;
+    // its fixed chunking keeps the chosen forest identical from run to run.
+    Graph ties(2000, false);
+    std::mt19937 rng(5);
+    for (int v = 1; v < 2000; ++v) ties.addEdge(v - 1, v, 3.0);
+    for (int i = 0; i < 20000; ++i) {
+        int u = static_cast<int>(rng() % 2000);
+        int v = static_cast<int>(rng() % 2000);
+        if (u != v) ties.addEdge(u, v, static_cast<double>(1 + rng() % 3));
+    }
+    MSTResult tied = filterKruskal.solve(ties);
+    assert(std::abs(tied.totalWeight - kruskal.solve(ties).totalWeight) < 1e-9);
+    assert(filterKruskal.solve(ties).edges == tied.edges);
+    std::cout << "Filter-Kruskal test passed" << std::endl;
+}
+
 void testPrimSmall() {
     Graph graph(4, false);
     graph.addEdge(0, 1, 1.0);
@@ -64,6 +196,69 @@ void testPrimSmall() {
     std::cout << "Prim small test passed" << std::endl;
 }
 
+void testIndexedHeapPrim() {
+    IndexedDaryHeap<double, 3> heap(8);
+    heap.push(5, 4.0);
+    heap.push(2, 7.0);
+    heap.push(7, 1.5);
+    heap.push(0, 9.0);
+    assert(heap.top() == 7 && heap.contains(2) && !heap.contains(1));
+    heap.decreaseKey(0, 0.5);
+    assert(heap.pop() == 0 && !heap.contains(0));
+    assert(heap.pop() == 7);
+    assert(heap.pop() == 5);
+    assert(heap.pop() == 2 && heap.empty());
+    assert(heap.getDecreaseCount() == 1 && heap.getPeakSize() == 4);
+
+    GraphGenerator generator(21);
+    Prim lazy;
+    Prim indexed(PrimHeap::Indexed);
+    assert(indexed.getName() == "Prim_IndexedHeap");
+    for (int i = 0; i < 3; ++i) {
+        auto graph = generator.generateSparseGraph(400, 4.0 + i);
+        MSTResult expected = lazy.solve(graph);
+        MSTResult result = indexed.solve(graph);
+        MSTResult csrResult = indexed.solve(CSRGraph(graph));
+        assert(result.edges.size() == expected.edges.size());
+        assert(std::abs(result.totalWeight - expected.totalWeight) < 1e-6);
+        assert(std::abs(csrResult.totalWeight - expected.totalWeight) < 1e-6);
+        assert(result.metrics.at("heap_pushes") <= 400);
+        assert(result.metrics.at("heap_pops") == 400);
+        assert(expected.metrics.at("heap_pushes") >= result.metrics.at("heap_pushes"));
+    }
+    std::cout << "Indexed heap Prim test passed" << std::endl;
+}
+
+void testPrimDense() {
+    GraphGenerator generator(33);
+    Prim heapPrim(PrimHeap::Lazy, 1e9);
+    std::vector<SimdLevel> levels = {SimdLevel::Scalar, SimdLevel::SSE2, PrimDense::detectSimdLevel()};
+    for (int V : {1, 2, 7, 61}) {
+        for (double density : {0.2, 1.0}) {
+            auto graph = generator.generateDenseGraph(V, density);
+            graph.addEdge(0, V - 1, 0.25);
+            MSTResult expected = heapPrim.solve(graph);
+            for (SimdLevel level : levels) {
+                PrimDense dense(level);
+                MSTResult result = dense.solve(graph);
+                MSTResult csrResult = dense.solve(CSRGraph(graph));
+                assert(result.edges.size() == expected.edges.size());
+                assert(std::abs(result.totalWeight - expected.totalWeight) < 1e-6);
+                assert(csrResult.edges == result.edges);
+            }
+        }
+    }
+
+    auto complete = generator.generateDenseGraph(200, 1.0);
+    Prim prim;
+    MSTResult dispatched = prim.solve(complete);
+    assert(dispatched.metrics.count("dense_dispatch") == 1);
+    assert(dispatched.algorithmName == prim.getName());
+    assert(std::abs(dispatched.totalWeight - heapPrim.solve(complete).totalWeight) < 1e-6);
+    assert(prim.solve(generator.generateSparseGraph(200, 3.0)).metrics.count("dense_dispatch") == 0);
+    std::cout << "Dense Prim test passed" << std::endl;
+}
+
 
 void testKKTSmall() {
     Graph graph(4, false);
@@ -80,6 +275,143 @@ void testKKTSmall() {
     std::cout << "KKT small test passed" << std::endl;
 }
 
+void testForestPathMax() {
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<double> weight(0.0, 10.0);
+    const int n = 300;
+    std::vector<std::tuple<int, int, double, int>> forest;
+    std::vector<std::vector<std::pair<int, double>>> adj(n);
+    for (int v = 1; v < n; ++v) {
+        if (v % 50 == 0) continue;
+        int u = std::uniform_int_distribution<int>(std::max(0, v - 20), v - 1)(rng);
+        if (u / 50 != v / 50) continue;
+        double w = weight(rng);
+        forest.emplace_back(v, u, w, v);
+        adj[u].emplace_back(v, w);
+        adj[v].emplace_back(u, w);
+    }
+
+    std::vector<std::pair<int, int>> queries;
+    std::uniform_int_distribution<int> vertex(0, n - 1);
+    for (int i = 0; i < 2000; ++i) queries.emplace_back(vertex(rng), vertex(rng));
+    queries.emplace_back(7, 7);
+    std::vector<double> answers = ForestPathMax::query(n, forest, queries);
+
+    for (size_t i = 0; i < queries.size(); ++i) {
+        int source = queries[i].first;
+        int target = queries[i].second;
+        std::vector<double> best(n, -1.0);
+        std::vector<bool> seen(n, false);
+        std::vector<int> stack = {source};
+        seen[source] = true;
+        best[source] = -std::numeric_limits<double>::infinity();
+        while (!stack.empty()) {
+            int u = stack.back();
+            stack.pop_back();
+            for (const auto& [v, w] : adj[u]) {
+                if (seen[v]) continue;
+                seen[v] = true;
+                best[v] = std::max(best[u], w);
+                stack.push_back(v);
+            }
+        }
+        double expected = seen[target] ? best[target] : std::numeric_limits<double>::infinity();
+        assert(answers[i] == expected);
+    }
+
+    // The resource overload answers the same and keeps its scratch on the arena.
+    Arena arena;
+    std::pmr::vector<std::tuple<int, int, double, int>> pooledForest(forest.begin(), forest.end(), &arena);
+    std::pmr::vector<std::pair<int, int>> pooledQueries(queries.begin(), queries.end(), &arena);
+    size_t inputAllocations = arena.getAllocationCount();
+    std::pmr::vector<double> pooled = ForestPathMax::query(n, pooledForest, pooledQueries, &arena);
+    assert(std::equal(pooled.begin(), pooled.end(), answers.begin(), answers.end()));
+    assert(arena.getAllocationCount() > inputAllocations + 10);
+
+    std::vector<std::tuple<int, int, double, int>> path = {{0, 1, 2.0, 0}, {1, 2, 5.0, 1}};
+    std::vector<std::tuple<int, int, double, int>> graph = {
+        {0, 1, 2.0, 0}, {1, 2, 5.0, 1}, {0, 2, 6.0, 2}, {0, 2, 4.0, 3}, {2, 3, 9.0, 4}};
+    auto heavy = MSTVerifier::findHeavyEdges(graph, path, 4);
+    assert(heavy.size() == 1 && heavy.count(2) == 1);
+    std::cout << "Forest path max test passed" << std::endl;
+}
+
+void testKKTArena() {
+    Arena arena(256);
+    {
+        std::pmr::vector<int> values(&arena);
+        for (int i = 0; i < 1000; ++i) values.push_back(i);
+        assert(values[999] == 999);
+    }
+    assert(arena.getAllocationCount() > 1);
+    assert(arena.getPeakBytes() >= arena.getBytesRequested() / 2);
+    arena.reset();
+    assert(arena.getAllocationCount() == 0 && arena.getHeldBytes() == 0);
+
+    GraphGenerator generator(31);
+    KKT kkt;
+    for (int i = 0; i < 3; ++i) {
+        auto graph = generator.generateSparseGraph(3000, 6.0 + i);
+        double expected = Kruskal().solve(graph).totalWeight;
+        MSTResult result = kkt.solve(graph);
+        assert(result.edges.size() == 2999);
+        assert(std::abs(result.totalWeight - expected) < 1e-6);
+        assert(result.metrics.at("arena_allocations") > 0);
+        assert(result.metrics.at("arena_peak_bytes") >= result.metrics.at("arena_requested_bytes"));
+        assert(std::abs(kkt.solve(CSRGraph(graph)).totalWeight - expected) < 1e-6);
+    }
+    std::cout << "KKT arena test passed" << std::endl;
+}
+
+void testKKTBaseCase() {
+    GraphGenerator generator(44);
+    auto graph = generator.generateSparseGraph(2000, 8.0);
+    graph.addEdge(5, 9, 0.0);
+    graph.addEdge(9, 5, 0.0);
+    double expected = Kruskal().solve(graph).totalWeight;
+    for (double density : {1.0, 2.0, 16.0}) {
+        KKT kkt(density);
+        MSTResult result = kkt.solve(graph);
+        assert(result.edges.size() == 1999);
+        assert(std::abs(result.totalWeight - expected) < 1e-6);
+        assert(result.metrics.at("base_cases") >= 1);
+        assert(result.metrics.at("base_case_ms") >= 0.0);
+        if (density == 16.0) {
+            assert(result.metrics.at("base_cases") == 1);
+            assert(result.metrics.at("base_case_edges") == graph.getEdges());
+        }
+    }
+    std::cout << "KKT base case test passed" << std::endl;
+}
+
+void testKKTParallel() {
+    CounterRng rng(7);
+    assert(rng.bits(3, 11) == CounterRng(7).bits(3, 11));
+    assert(rng.bits(3, 11) != rng.bits(4, 11) && rng.bits(3, 11) != rng.bits(3, 12));
+    double mean = 0.0;
+    for (int i = 0; i < 10000; ++i) mean += rng.uniform(0, i) / 10000;
+    assert(std::abs(mean - 0.5) < 0.02);
+
+    GraphGenerator generator(12);
+    for (int i = 0; i < 3; ++i) {
+        auto graph = i == 2 ? generator.generateDenseGraph(300, 0.3) : generator.generateSparseGraph(4000, 5.0 + 3 * i);
+        if (i == 1) graph.addEdge(10, 10, 0.1);
+        double expected = Kruskal().solve(graph).totalWeight;
+        MSTResult reference = KKTParallel(1, 99).solve(graph);
+        assert(reference.edges.size() == static_cast<size_t>(graph.getVertices() - 1));
+        assert(std::abs(reference.totalWeight - expected) < 1e-6);
+        for (int threads : {2, 4}) {
+            KKTParallel kkt(threads, 99);
+            MSTResult result = kkt.solve(graph);
+            assert(result.edges == reference.edges);
+            assert(result.metrics.at("samples") == reference.metrics.at("samples"));
+            assert(result.metrics.at("heavy_edges") == reference.metrics.at("heavy_edges"));
+            assert(std::abs(kkt.solve(CSRGraph(graph)).totalWeight - expected) < 1e-6);
+        }
+    }
+    std::cout << "Parallel KKT test passed" << std::endl;
+}
+
 void testBoruvkaSmall() {
     Graph graph(4, false);
     graph.addEdge(0, 1, 1.0);
@@ -95,6 +427,190 @@ void testBoruvkaSmall() {
     std::cout << "Boruvka small test passed" << std::endl;
 }
 
+void testThreadPool() {
+    auto pool = std::make_shared<ThreadPool>(3);
+    std::vector<int> phaseOne(3, 0);
+    std::vector<int> seen(3, 0);
+    pool->run([&](int tid) {
+        phaseOne[tid] = tid + 1;
+        pool->barrier();
+        seen[tid] = phaseOne[0] + phaseOne[1] + phaseOne[2];
+    });
+    assert(seen == std::vector<int>(3, 6));
+
+    std::vector<int> covered(1000, 0);
+    pool->parallelFor(covered.size(), [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) covered[i]++;
+    });
+    assert(std::count(covered.begin(), covered.end(), 1) == 1000);
+
+    bool caught = false;
+    try {
+        pool->run([](int tid) { if (tid == 2) throw std::runtime_error("worker failure"); });
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    assert(caught);
+
+    // A throw between barriers must release the participants parked in barrier().
+    bool badAlloc = false;
+    try {
+        pool->run([&](int tid) {
+            pool->barrier();
+            if (tid == 1) throw std::bad_alloc();
+            pool->barrier();
+            pool->barrier();
+        });
+    } catch (const std::bad_alloc&) {
+        badAlloc = true;
+    }
+    assert(badAlloc);
+    std::atomic<int> phases{0};
+    pool->run([&](int) {
+        pool->barrier();
+        phases++;
+        pool->barrier();
+    });
+    assert(phases == pool->size());
+
+    GraphGenerator generator(5);
+    auto graph = generator.generateSparseGraph(300, 4.0);
+    double expected = Kruskal().solve(graph).totalWeight;
+    BoruvkaParallel first(pool);
+    BoruvkaParallel second(pool);
+    assert(first.getName() == "Boruvka_Parallel_3threads");
+    for (int i = 0; i < 3; ++i) {
+        MSTResult result = (i % 2 ? first : second).solve(graph);
+        assert(result.edges.size() == 299);
+        assert(std::abs(result.totalWeight - expected) < 1e-6);
+        assert(result.metrics.at("rounds") >= 1);
+    }
+    std::cout << "Thread pool test passed" << std::endl;
+}
+
+void testWorkStealingScheduler() {
+    ThreadPool pool(4);
+    WorkStealingScheduler scheduler(pool, 16);
+    std::vector<std::atomic<int>> hits(100000);
+    std::atomic<long long> work{0};
+    scheduler.parallelFor(hits.size(), [&](int, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            hits[i]++;
+            // Skewed cost: the first tenth of the range is much more expensive.
+            int spins = i < hits.size() / 10 ? 200 : 1;
+            for (int s = 0; s < spins; ++s) work++;
+        }
+    });
+    for (const auto& hit : hits) assert(hit == 1);
+
+    size_t chunks = 0;
+    for (int t = 0; t < scheduler.size(); ++t) {
+        chunks += scheduler.getStats(t).chunks;
+        assert(scheduler.getStats(t).idleMilliseconds >= 0.0);
+    }
+    assert(chunks >= 4);
+    auto summary = scheduler.statsSummary();
+    assert(summary.count("worker_3_busy_ms") == 1 && summary.count("steals") == 1);
+    assert(summary.at("busy_imbalance") >= 1.0 - 1e-9);
+
+    std::vector<int> rounds(4, 0);
+    std::atomic<int> total{0};
+    pool.run([&](int tid) {
+        for (int round = 0; round < 3; ++round) {
+            scheduler.collectiveFor(tid, 5000, [&](int, size_t begin, size_t end) {
+                total += static_cast<int>(end - begin);
+            });
+            rounds[tid]++;
+        }
+    });
+    assert(total == 15000);
+    assert(rounds == std::vector<int>(4, 3));
+
+    // A throwing piece must not leave the other workers waiting for it.
+    bool threw = false;
+    try {
+        scheduler.parallelFor(100000, [&](int, size_t begin, size_t end) {
+            if (begin <= 50000 && 50000 < end) throw std::bad_alloc();
+        });
+    } catch (const std::bad_alloc&) {
+        threw = true;
+    }
+    assert(threw);
+    threw = false;
+    try {
+        pool.run([&](int tid) {
+            scheduler.collectiveFor(tid, 100000, [&](int, size_t begin, size_t end) {
+                if (begin <= 50000 && 50000 < end) throw std::bad_alloc();
+            });
+        });
+    } catch (const std::bad_alloc&) {
+        threw = true;
+    }
+    assert(threw);
+    total = 0;
+    scheduler.parallelFor(5000, [&](int, size_t begin, size_t end) { total += static_cast<int>(end - begin); });
+    assert(total == 5000);
+    scheduler.resetStats();
+    assert(scheduler.getStats(0).chunks == 0);
+    std::cout << "Work-stealing scheduler test passed" << std::endl;
+}
+
+void testBoruvkaDeterministicTies() {
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<int> vertex(0, 499);
+    std::uniform_int_distribution<int> weight(1, 4);
+    Graph graph(500, false);
+    for (int v = 1; v < 500; ++v) {
+        graph.addEdge(v - 1, v, weight(rng));
+    }
+    for (int i = 0; i < 4000; ++i) {
+        int u = vertex(rng);
+        int v = vertex(rng);
+        if (u != v) graph.addEdge(u, v, weight(rng));
+    }
+    double expected = Kruskal().solve(graph).totalWeight;
+    MSTResult reference = BoruvkaParallel(1).solve(graph);
+    assert(reference.edges.size() == 499);
+    assert(std::abs(reference.totalWeight - expected) < 1e-9);
+    for (int threads : {2, 3, 4}) {
+        BoruvkaParallel boruvka(threads);
+        for (int run = 0; run < 3; ++run) {
+            MSTResult result = boruvka.solve(graph);
+            assert(result.edges == reference.edges);
+        }
+        assert(boruvka.solve(CSRGraph(graph)).edges.size() == 499);
+    }
+    std::cout << "Boruvka deterministic ties test passed" << std::endl;
+}
+
+void testBoruvkaContracting() {
+    GraphGenerator generator(8);
+    auto graph = generator.generateSparseGraph(2000, 6.0);
+    graph.addEdge(3, 3, 0.5);
+    MSTResult reference = BoruvkaParallel(2).solve(graph);
+    for (int threads : {1, 3}) {
+        BoruvkaParallel contracting(threads, BoruvkaMode::Contract);
+        assert(contracting.getName() == "Boruvka_Contracting_" + std::to_string(threads) + "threads");
+        MSTResult result = contracting.solve(graph);
+        assert(result.edges == reference.edges);
+        assert(result.metrics.at("round_01_edges") == graph.getEdgeListWithIds().size());
+        assert(result.metrics.at("round_02_edges") < result.metrics.at("round_01_edges"));
+        assert(result.metrics.at("round_03_edges") < result.metrics.at("round_01_edges") / 2);
+        assert(contracting.solve(CSRGraph(graph)).edges.size() == 1999);
+    }
+
+    Graph forest(6, false);
+    forest.addEdge(0, 1, 2.0);
+    forest.addEdge(1, 2, 1.0);
+    forest.addEdge(0, 2, 1.0);
+    forest.addEdge(3, 4, 5.0);
+    forest.addEdge(3, 4, 4.0);
+    MSTResult split = BoruvkaParallel(2, BoruvkaMode::Contract).solve(forest);
+    assert(split.edges.size() == 3);
+    assert(std::abs(split.totalWeight - 6.0) < 1e-9);
+    std::cout << "Contracting Boruvka test passed" << std::endl;
+}
+
 void testEdgeCases() {
     Graph single(1, false);
     Kruskal kruskal;
@@ -132,6 +648,52 @@ void testAllAlgorithmConsistency() {
     std::cout << "consistency test passed" << std::endl;
 }
 
+void testMSTVerifier() {
+    GraphGenerator generator(21);
+    Graph graph = generator.generateSparseGraph(3000, 4.0);
+    graph.addEdge(5, 5, 0.01);
+    MSTResult result = Kruskal().solve(graph);
+    for (int threads : {1, 4}) {
+        VerificationReport report = MSTVerifier::verify(graph, result, threads);
+        assert(report.valid() && report.message == "ok");
+        assert(report.treeEdges == report.expectedTreeEdges);
+        assert(MSTVerifier::verify(CSRGraph(graph), result, threads).valid());
+    }
+
+    Graph split(6, false);
+    split.addEdge(0, 1, 1.0);
+    split.addEdge(1, 2, 2.0);
+    split.addEdge(0, 2, 3.0);
+    split.addEdge(3, 4, 1.0);
+    MSTResult forest = Kruskal().solve(split);
+    VerificationReport report = MSTVerifier::verify(split, forest);
+    assert(report.valid() && report.expectedTreeEdges == 3);
+
+    MSTResult swapped;
+    swapped.edges = {{0, 1, 1.0}, {0, 2, 3.0}, {3, 4, 1.0}};
+    swapped.totalWeight = 5.0;
+    report = MSTVerifier::verify(split, swapped);
+    assert(report.spanning && report.acyclic && !report.minimal && report.lighterEdges == 1);
+
+    MSTResult cyclic = forest;
+    cyclic.edges.push_back({0, 2, 3.0});
+    cyclic.totalWeight += 3.0;
+    report = MSTVerifier::verify(split, cyclic);
+    assert(!report.acyclic && !report.spanning && !report.valid());
+
+    MSTResult missing = forest;
+    missing.edges.pop_back();
+    missing.totalWeight -= 1.0;
+    report = MSTVerifier::verify(split, missing);
+    assert(report.acyclic && !report.spanning && report.minimal);
+
+    MSTResult bogus = forest;
+    std::get<2>(bogus.edges[0]) = 0.5;
+    report = MSTVerifier::verify(split, bogus);
+    assert(report.unknownEdges == 1 && !report.weightMatches && !report.valid());
+    std::cout << "MST verifier test passed" << std::endl;
+}
+
 void testGraphGenerator() {
     GraphGenerator generator(42); 
     
@@ -140,9 +702,457 @@ void testGraphGenerator() {
     assert(sparse.getEdges() >= 99); 
     Graph dense = generator.generateDenseGraph(50, 0.5);
     assert(dense.isConnected());
+
+    auto sameGraph = [](const Graph& a, const Graph& b) {
+        return a.getVertices() == b.getVertices() && a.getEdgeListWithIds() == b.getEdgeListWithIds();
+    };
+    auto distinctPairs = [](const Graph& graph) {
+        std::vector<std::pair<int, int>> pairs;
+        for (const auto& [u, v, weight, id] : graph.getEdgeListWithIds()) {
+            if (u == v) return false;
+            pairs.emplace_back(std::min(u, v), std::max(u, v));
+        }
+        std::sort(pairs.begin(), pairs.end());
+        return std::adjacent_find(pairs.begin(), pairs.end()) == pairs.end();
+    };
+    GraphGenerator single(9, 1);
+    Graph reference = single.generateSparseGraph(20000, 8.0);
+    Graph grid = single.generateGridGraph(30, 40);
+    assert(reference.getEdges() == 80000 && reference.isConnected() && distinctPairs(reference));
+    assert(grid.getEdges() == 30 * 39 + 29 * 40);
+    for (int threads : {2, 4}) {
+        GraphGenerator parallel(9, threads);
+        assert(sameGraph(parallel.generateSparseGraph(20000, 8.0), reference));
+        assert(sameGraph(parallel.generateGridGraph(30, 40), grid));
+    }
+    assert(!sameGraph(single.generateSparseGraph(20000, 8.0), reference));
+
+    Graph saturated = GraphGenerator(3, 4).generateSparseGraph(60, 100.0);
+    assert(saturated.getEdges() <= 60 * 59 / 2 && distinctPairs(saturated));
+    assert(GraphGenerator(3, 4).generateSparseGraph(50000, 2.5).getEdges() == 62500);
+
+    Graph denseReference = GraphGenerator(5, 1).generateDenseGraph(20000, 0.001);
+    assert(denseReference.getEdges() == 199990 && denseReference.isConnected() && distinctPairs(denseReference));
+    assert(sameGraph(GraphGenerator(5, 3).generateDenseGraph(20000, 0.001), denseReference));
+    size_t lowRows = 0;
+    for (const auto& [u, v, weight, id] : denseReference.getEdgeListWithIds()) {
+        if (v > u + 1 && u < 5858) lowRows++;
+    }
+    // Rows below 5858 hold half of the non-path pairs.
+    assert(std::abs(static_cast<double>(lowRows) / (199990 - 19999) - 0.5) < 0.01);
+    Graph full = GraphGenerator(5, 2).generateDenseGraph(40, 1.0);
+    assert(full.getEdges() == 40 * 39 / 2 && distinctPairs(full));
     std::cout << "Graph generator tests passed" << std::endl;
 }
 
+void testGraphFamilies() {
+    auto pairsOf = [](const Graph& graph) {
+        std::vector<std::pair<int, int>> pairs;
+        for (const auto& [u, v, weight, id] : graph.getEdgeListWithIds()) {
+            pairs.emplace_back(std::min(u, v), std::max(u, v));
+        }
+        return pairs;
+    };
+    auto maxDegree = [](const Graph& graph) {
+        std::vector<int> degree(graph.getVertices(), 0);
+        for (const auto& [u, v, weight, id] : graph.getEdgeListWithIds()) {
+            degree[u]++;
+            degree[v]++;
+        }
+        return *std::max_element(degree.begin(), degree.end());
+    };
+
+    for (GraphFamily family : {GraphFamily::Uniform, GraphFamily::RMAT, GraphFamily::Geometric,
+                               GraphFamily::KNN, GraphFamily::PowerLaw}) {
+        assert(GraphGenerator::parseFamily(GraphGenerator::familyName(family)) == family);
+        Graph reference = GraphGenerator(17, 1).generate(family, 5000, 8.0);
+        assert(GraphGenerator(17, 4).generate(family, 5000, 8.0).getEdgeListWithIds() ==
+               reference.getEdgeListWithIds());
+        auto pairs = pairsOf(reference);
+        std::sort(pairs.begin(), pairs.end());
+        assert(std::adjacent_find(pairs.begin(), pairs.end()) == pairs.end());
+        for (const auto& [u, v] : pairs) assert(u != v);
+        double degree = 2.0 * reference.getEdges() / reference.getVertices();
+        assert(degree > 5.0 && degree < 11.0);
+        // Sparse draws leave many components; the generator joins them.
+        assert(reference.isConnected());
+        assert(GraphGenerator(17).generate(family, 3000, 1.5).isConnected());
+    }
+    bool threw = false;
+    try {
+        GraphGenerator::parseFamily("hypercube");
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    GraphGenerator generator(4);
+    assert(maxDegree(generator.generateRMATGraph(1 << 14, 8.0)) > 200);
+    assert(maxDegree(generator.generatePowerLawGraph(1 << 14, 8.0, 2.2)) > 200);
+    assert(maxDegree(generator.generateSparseGraph(1 << 14, 8.0)) < 40);
+
+    // Geometric and k-NN graphs against brute force over the same points.
+    const int V = 600;
+    Graph geometric = GraphGenerator(8).generateGeometricGraph(V, 0.08);
+    Graph knn = GraphGenerator(8).generateKNNGraph(V, 5);
+    // Edges joining components are longer than the radius by definition.
+    size_t withinRadius = 0;
+    for (const auto& [u, v, weight, id] : geometric.getEdgeListWithIds()) {
+        if (weight <= 0.08) withinRadius++;
+    }
+    assert(geometric.isConnected());
+    size_t brute = 0;
+    std::vector<std::pair<double, double>> points(V);
+    CounterRng rng(8);
+    for (int i = 0; i < V; ++i) points[i] = {rng.uniform(0, 2 * i), rng.uniform(0, 2 * i + 1)};
+    std::vector<std::vector<int>> adjacency(V);
+    for (const auto& [u, v, weight, id] : knn.getEdgeListWithIds()) {
+        assert(std::abs(weight - std::hypot(points[u].first - points[v].first,
+                                            points[u].second - points[v].second)) < 1e-12);
+        adjacency[u].push_back(v);
+        adjacency[v].push_back(u);
+    }
+    for (int i = 0; i < V; ++i) {
+        std::vector<std::pair<double, int>> all;
+        for (int j = 0; j < V; ++j) {
+            if (j == i) continue;
+            double d = std::hypot(points[i].first - points[j].first, points[i].second - points[j].second);
+            if (j > i && d <= 0.08) brute++;
+            all.push_back({d, j});
+        }
+        std::sort(all.begin(), all.end());
+        for (int m = 0; m < 5; ++m) {
+            assert(std::count(adjacency[i].begin(), adjacency[i].end(), all[m].second) == 1);
+        }
+    }
+    assert(withinRadius == brute);
+    std::cout << "Graph family tests passed" << std::endl;
+}
+
+void testCSRGraph() {
+    GraphGenerator generator(7);
+    Graph graph = generator.generateSparseGraph(200, 6.0);
+    CSRGraph csr(graph);
+    assert(csr.getVertices() == graph.getVertices());
+    assert(csr.getEdges() == static_cast<size_t>(graph.getEdges()));
+    assert(csr.getEntries() == 2 * csr.getEdges());
+    assert(csr.isConnected());
+    assert(csr.memoryBytes() < graph.memoryBytes());
+
+    Kruskal kruskal;
+    Prim prim;
+    KKT kkt;
+    BoruvkaParallel boruvka(2);
+    double expected = kruskal.solve(graph).totalWeight;
+    assert(std::abs(kruskal.solve(csr).totalWeight - expected) < 1e-9);
+    assert(std::abs(prim.solve(csr).totalWeight - expected) < 1e-9);
+    assert(std::abs(kkt.solve(csr).totalWeight - expected) < 1e-9);
+    assert(std::abs(boruvka.solve(csr).totalWeight - expected) < 1e-9);
+
+    // The row walk used by the CSR solve paths sees edges in getEdgeListWithIds() order.
+    auto listed = csr.getEdgeListWithIds();
+    ThreadPool pool(3);
+    std::vector<std::tuple<int, int, double>> walked;
+    forEachCSREdge(csr, &pool, [&](size_t total) { walked.resize(total); },
+                   [&](size_t i, int u, int v, double w) { walked[i] = std::make_tuple(u, v, w); });
+    assert(walked.size() == listed.size());
+    for (size_t i = 0; i < listed.size(); ++i) {
+        assert(std::get<0>(walked[i]) == std::get<0>(listed[i]) && std::get<1>(walked[i]) == std::get<1>(listed[i]));
+        assert(std::get<2>(walked[i]) == std::get<2>(listed[i]));
+    }
+    std::cout << "CSR graph test passed" << std::endl;
+}
+
+void testGraphBuilder() {
+    GraphGenerator generator(11);
+    Graph reference = generator.generateSparseGraph(300, 8.0);
+    const auto& edges = reference.getEdgeList();
+
+    GraphBuilder builder(300, edges.size(), false, 4);
+    GraphBuilder csrBuilder(300, edges.size(), false, 4);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<BuilderEdge> batch;
+            for (size_t i = t; i < edges.size(); i += 4) {
+                batch.push_back({std::get<0>(edges[i]), std::get<1>(edges[i]), std::get<2>(edges[i])});
+            }
+            builder.addEdges(batch);
+            csrBuilder.addEdges(batch);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    Graph built = builder.build();
+    CSRGraph csr = csrBuilder.buildCSR();
+    assert(built.getEdges() == reference.getEdges());
+    assert(built.getIdToEdgeMap().size() == edges.size());
+    assert(built.isConnected());
+    assert(csr.getEntries() == 2 * edges.size());
+
+    Kruskal kruskal;
+    double expected = kruskal.solve(reference).totalWeight;
+    assert(std::abs(kruskal.solve(built).totalWeight - expected) < 1e-9);
+    assert(std::abs(kruskal.solve(csr).totalWeight - expected) < 1e-9);
+    std::cout << "Graph builder test passed" << std::endl;
+}
+
+void testGraphFileRoundTrip() {
+    GraphGenerator generator(5);
+    CSRGraph csr(generator.generateSparseGraph(500, 6.0));
+    const std::string path = "basic_tests_graph.csrg";
+    GraphFile::write(path, csr);
+
+    GraphFileHeader header = GraphFile::readHeader(path);
+    assert(header.version == GraphFile::VERSION);
+    assert(header.numVertices == 500);
+    assert(header.numEdges == csr.getEdges());
+
+    CSRGraph mapped = GraphFile::map(path);
+    assert(mapped.isMapped());
+    assert(mapped.getVertices() == csr.getVertices());
+    assert(mapped.getEntries() == csr.getEntries());
+    for (int u = 0; u <= csr.getVertices(); ++u) {
+        assert(mapped.getOffsets()[u] == csr.getOffsets()[u]);
+    }
+    for (size_t k = 0; k < csr.getEntries(); ++k) {
+        assert(mapped.getTargets()[k] == csr.getTargets()[k]);
+        assert(mapped.getWeights()[k] == csr.getWeights()[k]);
+        assert(mapped.getEdgeIds()[k] == csr.getEdgeIds()[k]);
+    }
+
+    Kruskal kruskal;
+    assert(std::abs(kruskal.solve(mapped).totalWeight - kruskal.solve(csr).totalWeight) < 1e-9);
+
+    // Corrupt one target, then one offset: both must be rejected by the validation pass.
+    auto corrupt = [&](uint64_t position, const void* value, size_t bytes) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(position));
+        file.write(static_cast<const char*>(value), bytes);
+    };
+    auto rejects = [&]() {
+        try {
+            GraphFile::map(path);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+    int badTarget = 500;
+    corrupt(header.targetsOffset + 3 * sizeof(int32_t), &badTarget, sizeof(badTarget));
+    assert(rejects());
+    assert(GraphFile::map(path, false).getTargets()[3] == badTarget);
+    GraphFile::write(path, csr);
+    uint64_t badOffset = csr.getEntries() + 1;
+    corrupt(header.offsetsOffset + 7 * sizeof(uint64_t), &badOffset, sizeof(badOffset));
+    assert(rejects());
+    std::remove(path.c_str());
+
+    bool rejected = false;
+    try {
+        GraphFile::map("basic_tests_missing.csrg");
+    } catch (const std::runtime_error&) {
+        rejected = true;
+    }
+    assert(rejected);
+    std::cout << "Graph file round trip test passed" << std::endl;
+}
+
+void testStreamGenerator() {
+    const std::string reference = "basic_tests_stream_a.csrg";
+    const std::string windowed = "basic_tests_stream_b.csrg";
+    auto readAll = [](const std::string& path) {
+        std::ifstream in(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    };
+    struct Case {
+        GraphFamily family;
+        int vertices;
+        double density;
+        size_t expectedEdges;
+    };
+    for (const Case& c : {Case{GraphFamily::Uniform, 3000, 6.0, 9000}, Case{GraphFamily::Uniform, 400, 0.2, 15960},
+                          Case{GraphFamily::Uniform, 3000, 1.0, 2999},
+                          Case{GraphFamily::Grid, 2500, 0.0, 4900}, Case{GraphFamily::PowerLaw, 3000, 6.0, 9000},
+                          Case{GraphFamily::RMAT, 4096, 6.0, 12288}}) {
+        StreamStats whole = StreamGenerator(11, 1).writeCSR(reference, c.family, c.vertices, c.density);
+        StreamStats split = StreamGenerator(11, 4, 4096).writeCSR(windowed, c.family, c.vertices, c.density);
+        assert(whole.windows == 1 && split.windows > 10 && split.bufferBytes < whole.bufferBytes);
+        assert(whole.spillBytes == 0 && split.spillBytes == 2 * split.edges * 20);
+        assert(whole.edges == split.edges && readAll(reference) == readAll(windowed));
+        assert(std::abs(static_cast<double>(whole.edges) - c.expectedEdges) < 0.05 * c.expectedEdges);
+
+        CSRGraph graph = GraphFile::map(reference);
+        std::vector<int> seen(graph.getEdges(), 0);
+        for (int u = 0; u < graph.getVertices(); ++u) {
+            for (size_t k = graph.rowBegin(u); k < graph.rowEnd(u); ++k) {
+                assert(graph.getTargets()[k] != u);
+                assert(k == graph.rowBegin(u) || graph.getEdgeIds()[k - 1] < graph.getEdgeIds()[k]);
+                seen[graph.getEdgeIds()[k]]++;
+            }
+        }
+        assert(std::all_of(seen.begin(), seen.end(), [](int count) { return count == 2; }));
+        assert(MSTVerifier::verify(graph, Kruskal().solve(graph)).valid());
+        if (c.family != GraphFamily::PowerLaw && c.family != GraphFamily::RMAT) assert(graph.isConnected());
+    }
+    std::remove(reference.c_str());
+    std::remove(windowed.c_str());
+
+    bool rejected = false;
+    try {
+        StreamGenerator(1).writeCSR(reference, GraphFamily::KNN, 100, 4.0);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    assert(rejected);
+    std::cout << "Stream generator test passed" << std::endl;
+}
+
+void testGraphLoaders() {
+    GraphGenerator generator(9);
+    Graph graph = generator.generateSparseGraph(400, 6.0);
+    const auto& edges = graph.getEdgeList();
+    int V = graph.getVertices();
+
+    std::ofstream dimacs("basic_tests.gr");
+    dimacs << std::setprecision(17) << "c test graph\np sp " << V << " " << 2 * edges.size() << "\n";
+    std::ofstream snap("basic_tests.txt");
+    snap << std::setprecision(17) << "# test graph\n";
+    std::vector<std::vector<std::pair<int, double>>> neighbors(V);
+    for (const auto& [u, v, w] : edges) {
+        dimacs << "a " << u + 1 << " " << v + 1 << " " << w << "\na " << v + 1 << " " << u + 1 << " " << w << "\n";
+        snap << u << "\t" << v << "\t" << w << "\n";
+        neighbors[u].push_back({v, w});
+        neighbors[v].push_back({u, w});
+    }
+    dimacs.close();
+    snap.close();
+    std::ofstream metis("basic_tests.graph");
+    metis << std::setprecision(17) << "% test graph\n" << V << " " << edges.size() << " 1\n";
+    for (int u = 0; u < V; ++u) {
+        for (const auto& [v, w] : neighbors[u]) {
+            metis << v + 1 << " " << w << " ";
+        }
+        metis << "\n";
+    }
+    metis.close();
+
+    Kruskal kruskal;
+    double expected = kruskal.solve(graph).totalWeight;
+    LoadOptions options;
+    options.threads = 3;
+    options.chunkBytes = 4096;
+    for (const std::string path : {"basic_tests.gr", "basic_tests.txt", "basic_tests.graph"}) {
+        LoadStats stats;
+        CSRGraph loaded = GraphLoader::loadCSR(path, GraphLoader::detectFormat(path), options, &stats);
+        assert(loaded.getVertices() == V);
+        assert(loaded.getEdges() == edges.size());
+        assert(stats.bytes > 0 && stats.edges == edges.size());
+        assert(std::abs(kruskal.solve(loaded).totalWeight - expected) < 1e-6);
+        Graph mutableGraph = GraphLoader::load(path, GraphLoader::detectFormat(path), options);
+        assert(std::abs(kruskal.solve(mutableGraph).totalWeight - expected) < 1e-6);
+        std::remove(path.c_str());
+    }
+    std::cout << "Graph loader test passed" << std::endl;
+}
+
+void testStatistics() {
+    SampleSummary summary = Statistics::summarize({5.0, 1.0, 4.0, 2.0, 3.0});
+    assert(summary.count == 5);
+    assert(summary.min == 1.0 && summary.max == 5.0);
+    assert(summary.median == 3.0 && summary.mean == 3.0);
+    assert(std::abs(summary.p95 - 4.8) < 1e-9);
+    assert(std::abs(summary.stddev - std::sqrt(2.5)) < 1e-9);
+    double halfWidth = 2.776 * std::sqrt(2.5) / std::sqrt(5.0);
+    assert(std::abs(summary.ciLow - (3.0 - halfWidth)) < 1e-9);
+    assert(std::abs(summary.ciHigh - (3.0 + halfWidth)) < 1e-9);
+
+    SampleSummary single = Statistics::summarize({7.0});
+    assert(single.count == 1 && single.median == 7.0 && single.stddev == 0.0);
+    assert(single.ciLow == 7.0 && single.ciHigh == 7.0);
+    assert(Statistics::summarize({}).count == 0);
+    assert(Statistics::quantile({1.0, 2.0}, 0.5) == 1.5);
+    assert(Statistics::tCritical(31) == 2.042 && Statistics::tCritical(40) == 2.021);
+    assert(Statistics::tCritical(61) == 2.000 && Statistics::tCritical(1000) == 1.980);
+    std::cout << "Statistics test passed" << std::endl;
+}
+
+void testAlgorithmFactory() {
+    GraphGenerator generator(77);
+    Graph graph = generator.generateSparseGraph(300, 5.0);
+    CSRGraph csr(graph);
+    double expected = Kruskal().solve(graph).totalWeight;
+    for (const auto& name : AlgorithmFactory::names()) {
+        auto algorithm = AlgorithmFactory::create(name, 2);
+        assert(algorithm != nullptr);
+        assert(std::abs(algorithm->solve(graph).totalWeight - expected) < 1e-6);
+        assert(std::abs(algorithm->solve(csr).totalWeight - expected) < 1e-6);
+    }
+    assert(AlgorithmFactory::isParallel("boruvka") && !AlgorithmFactory::isParallel("prim"));
+    bool threw = false;
+    try {
+        AlgorithmFactory::create("no_such_algorithm");
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    std::cout << "Algorithm factory test passed" << std::endl;
+}
+
+void testAllocationTracker() {
+    if (!AllocationTracker::enabled()) {
+        std::cout << "Allocation tracker test skipped" << std::endl;
+        return;
+    }
+    const size_t bytes = 1 << 20;
+    AllocationTracker::Scope outer;
+    {
+        AllocationTracker::Scope inner;
+        std::vector<char> first(bytes);
+        first.clear();
+        first.shrink_to_fit();
+        std::vector<char> second(bytes / 2);
+        AllocationStats stats = inner.stop();
+        assert(stats.allocations >= 2);
+        assert(stats.bytesAllocated >= bytes + bytes / 2);
+        assert(stats.peakBytes >= bytes && stats.peakBytes < bytes + bytes / 2);
+        assert(stats.peakRssBytes == 0);
+    }
+    ThreadPool pool(4);
+    {
+        AllocationTracker::Scope pooled;
+        std::vector<std::vector<char>> perThread(pool.size());
+        pool.run([&](int t) {
+            perThread[t].resize(40 * 1024);
+            pool.barrier();
+        });
+        AllocationStats stats = pooled.stop();
+        assert(stats.bytesAllocated >= static_cast<size_t>(pool.size()) * 40 * 1024);
+        assert(stats.peakBytes >= static_cast<size_t>(pool.size()) * 40 * 1024);
+    }
+    std::vector<char> small(bytes / 4);
+    AllocationStats outerStats = outer.stop();
+    assert(outerStats.peakBytes >= bytes);
+
+    AllocationTracker::setRssSamplingInterval(1);
+    AllocationTracker::Scope sampled;
+    std::vector<char> touched(4 * bytes, 1);
+    AllocationStats sampledStats = sampled.stop();
+    AllocationTracker::setRssSamplingInterval(0);
+    assert(sampledStats.peakRssBytes >= touched.size());
+    assert(MemoryMonitor::getResidentBytes() > 0);
+
+    GraphGenerator generator(5);
+    Graph graph = generator.generateSparseGraph(2000, 5.0);
+    MSTResult result = Kruskal().solve(graph);
+    assert(result.allocations > 0 && result.bytesAllocated >= result.peakHeapBytes);
+    assert(result.peakHeapBytes >= graph.getEdges() * sizeof(std::tuple<int, int, double>));
+    assert(result.memoryUsage == (result.peakHeapBytes + 1023) / 1024);
+    std::cout << "Allocation tracker test passed" << std::endl;
+}
+
 void testPerformanceSmall() {
     GraphGenerator generator(123);
     Graph graph = generator.generateDenseGraph(100, 0.3);
@@ -166,13 +1176,36 @@ void testPerformanceSmall() {
 void runAllTests() {
     testGraphBasic();
     testUnionFind();
+    testConcurrentUnionFind();
     testKruskalSmall();
+    testRadixEdgeSort();
+    testFilterKruskal();
     testPrimSmall(); 
+    testIndexedHeapPrim();
+    testPrimDense();
     testKKTSmall();
+    testForestPathMax();
+    testKKTArena();
+    testKKTBaseCase();
+    testKKTParallel();
     testBoruvkaSmall();
+    testThreadPool();
+    testWorkStealingScheduler();
+    testBoruvkaDeterministicTies();
+    testBoruvkaContracting();
     testAllAlgorithmConsistency();  
+    testMSTVerifier();
     testGraphGenerator();
+    testGraphFamilies();
     testEdgeCases(); 
+    testCSRGraph();
+    testGraphBuilder();
+    testGraphFileRoundTrip();
+    testStreamGenerator();
+    testGraphLoaders();
+    testStatistics();
+    testAlgorithmFactory();
+    testAllocationTracker();
     testPerformanceSmall();
     
     std::cout << "\nAll basic tests passed!" << std::endl;
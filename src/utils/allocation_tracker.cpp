@@ -0,0 +1,220 @@
+#include "allocation_tracker.hpp"
+#include "memory_monitor.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#ifdef __linux__
+#include <malloc.h>
+#endif
+
+namespace {
+constexpr long long FLUSH_BYTES = 64 * 1024;
+
+struct ThreadCounters {
+    long long pendingLive;
+    size_t pendingBytes;
+    size_t pendingAllocations;
+};
+
+// Constant-initialised so the hooks can run before and after static construction.
+thread_local ThreadCounters local = {0, 0, 0};
+std::atomic<long long> sharedLive{0};
+std::atomic<long long> sharedPeak{0};
+std::atomic<size_t> sharedBytes{0};
+std::atomic<size_t> sharedAllocations{0};
+std::atomic<int> rssInterval{0};
+
+void raisePeak(long long value) {
+    long long peak = sharedPeak.load(std::memory_order_relaxed);
+    while (value > peak && !sharedPeak.compare_exchange_weak(peak, value, std::memory_order_relaxed)) {
+    }
+}
+
+void flush(ThreadCounters& counters) {
+    long long live = sharedLive.fetch_add(counters.pendingLive, std::memory_order_relaxed) + counters.pendingLive;
+    sharedBytes.fetch_add(counters.pendingBytes, std::memory_order_relaxed);
+    sharedAllocations.fetch_add(counters.pendingAllocations, std::memory_order_relaxed);
+    counters = {0, 0, 0};
+    raisePeak(live);
+}
+
+#ifdef __linux__
+void noteAllocation(void* p) {
+    size_t bytes = malloc_usable_size(p);
+    ThreadCounters& counters = local;
+    counters.pendingLive += static_cast<long long>(bytes);
+    counters.pendingBytes += bytes;
+    counters.pendingAllocations++;
+    if (counters.pendingLive >= FLUSH_BYTES || counters.pendingBytes >= static_cast<size_t>(FLUSH_BYTES)) {
+        flush(counters);
+    }
+}
+
+void noteRelease(void* p) {
+    if (p == nullptr) return;
+    ThreadCounters& counters = local;
+    counters.pendingLive -= static_cast<long long>(malloc_usable_size(p));
+    if (counters.pendingLive <= -FLUSH_BYTES) flush(counters);
+}
+
+void* allocate(size_t size) {
+    if (size == 0) size = 1;
+    void* p;
+    while ((p = std::malloc(size)) == nullptr) {
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) throw std::bad_alloc();
+        handler();
+    }
+    noteAllocation(p);
+    return p;
+}
+
+void* allocateAligned(size_t size, std::align_val_t alignment) {
+    if (size == 0) size = 1;
+    size_t align = std::max(static_cast<size_t>(alignment), sizeof(void*));
+    void* p;
+    while (posix_memalign(&p, align, size) != 0) {
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) throw std::bad_alloc();
+        handler();
+    }
+    noteAllocation(p);
+    return p;
+}
+
+void release(void* p) noexcept {
+    noteRelease(p);
+    std::free(p);
+}
+#endif
+}
+
+#ifdef __linux__
+void* operator new(size_t size) { return allocate(size); }
+void* operator new[](size_t size) { return allocate(size); }
+void* operator new(size_t size, std::align_val_t alignment) { return allocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return allocateAligned(size, alignment); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    try {
+        return allocate(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return allocateAligned(size, alignment);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    try {
+        return allocateAligned(size, alignment);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void operator delete(void* p) noexcept { release(p); }
+void operator delete[](void* p) noexcept { release(p); }
+void operator delete(void* p, size_t) noexcept { release(p); }
+void operator delete[](void* p, size_t) noexcept { release(p); }
+void operator delete(void* p, std::align_val_t) noexcept { release(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { release(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { release(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { release(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { release(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { release(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { release(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { release(p); }
+#endif
+
+bool AllocationTracker::enabled() {
+#ifdef __linux__
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t AllocationTracker::liveBytes() {
+    flush(local);
+    return static_cast<size_t>(std::max(0LL, sharedLive.load(std::memory_order_relaxed)));
+}
+
+void AllocationTracker::flushThread() {
+    flush(local);
+}
+
+void AllocationTracker::setRssSamplingInterval(int milliseconds) {
+    rssInterval.store(std::max(0, milliseconds), std::memory_order_relaxed);
+}
+
+int AllocationTracker::getRssSamplingInterval() {
+    return rssInterval.load(std::memory_order_relaxed);
+}
+
+AllocationTracker::Scope::Scope() : stopped(false), sampling(false), rssPeak(0) {
+    int interval = getRssSamplingInterval();
+    if (interval > 0) {
+        sampling = true;
+        rssPeak = MemoryMonitor::getResidentBytes();
+        sampler = std::thread([this, interval]() {
+            std::unique_lock<std::mutex> lock(samplerMutex);
+            while (sampling) {
+                rssPeak = std::max(rssPeak, MemoryMonitor::getResidentBytes());
+                samplerWake.wait_for(lock, std::chrono::milliseconds(interval));
+            }
+            flush(local);
+        });
+    }
+
+    // Start the peak afresh at the current live size; stop() folds the old peak back in.
+    flush(local);
+    long long live = sharedLive.load(std::memory_order_relaxed);
+    baseLive = static_cast<size_t>(std::max(0LL, live));
+    baseAllocated = sharedBytes.load(std::memory_order_relaxed);
+    baseAllocations = sharedAllocations.load(std::memory_order_relaxed);
+    savedPeak = static_cast<size_t>(std::max(0LL, sharedPeak.exchange(live, std::memory_order_relaxed)));
+}
+
+AllocationTracker::Scope::~Scope() {
+    if (!stopped) stop();
+}
+
+AllocationStats AllocationTracker::Scope::stop() {
+    AllocationStats stats;
+    if (stopped) return stats;
+    stopped = true;
+
+    flush(local);
+    long long peak = sharedPeak.load(std::memory_order_relaxed);
+    stats.bytesAllocated = sharedBytes.load(std::memory_order_relaxed) - baseAllocated;
+    stats.allocations = sharedAllocations.load(std::memory_order_relaxed) - baseAllocations;
+    stats.peakBytes = static_cast<size_t>(std::max(0LL, peak - static_cast<long long>(baseLive)));
+    raisePeak(static_cast<long long>(savedPeak));
+
+    if (sampler.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(samplerMutex);
+            sampling = false;
+        }
+        samplerWake.notify_one();
+        sampler.join();
+        stats.peakRssBytes = std::max(rssPeak, MemoryMonitor::getResidentBytes());
+    }
+    return stats;
+}
\ No newline at end of file
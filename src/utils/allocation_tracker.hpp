@@ -0,0 +1,61 @@
+#ifndef ALLOCATION_TRACKER_HPP
+#define ALLOCATION_TRACKER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+// Heap traffic seen by the global operator new/delete replacements in
+// allocation_tracker.cpp, measured between start and stop of a scope.
+struct AllocationStats {
+    size_t bytesAllocated;
+    size_t allocations;
+    size_t peakBytes;
+    size_t peakRssBytes;
+
+    AllocationStats() : bytesAllocated(0), allocations(0), peakBytes(0), peakRssBytes(0) {}
+};
+
+// Every thread counts into thread-local counters and publishes them to the
+// shared totals once 64 KB of traffic has built up, so totals and the live-byte
+// peak are exact for the measuring thread and lag by less than 64 KB for any
+// other thread still running. Sizes are the usable sizes reported by malloc.
+class AllocationTracker {
+public:
+    // False where the hooks cannot size a block on release (non-Linux builds).
+    static bool enabled();
+    static size_t liveBytes();
+    // Publishes the calling thread's pending counters; worker threads call it before exiting.
+    static void flushThread();
+    // Interval of the /proc/self/statm sampler started by each scope, 0 to disable (the default).
+    static void setRssSamplingInterval(int milliseconds);
+    static int getRssSamplingInterval();
+
+    // Scopes may nest on one thread (the outer peak still sees the inner one),
+    // but two scopes must not run concurrently on different threads.
+    class Scope {
+    private:
+        size_t baseLive;
+        size_t baseAllocated;
+        size_t baseAllocations;
+        size_t savedPeak;
+        bool stopped;
+        bool sampling;
+        size_t rssPeak;
+        std::mutex samplerMutex;
+        std::condition_variable samplerWake;
+        std::thread sampler;
+
+    public:
+        Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        ~Scope();
+
+        AllocationStats stop();
+    };
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,29 @@
+#include "arena.hpp"
+#include <algorithm>
+
+void* Arena::CountingUpstream::do_allocate(size_t bytes, size_t alignment) {
+    void* p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    heldBytes += bytes;
+    peakBytes = std::max(peakBytes, heldBytes);
+    return p;
+}
+
+void Arena::CountingUpstream::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    heldBytes -= bytes;
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+Arena::Arena(size_t initialBytes) : buffer(initialBytes, &upstream) {}
+
+void* Arena::do_allocate(size_t bytes, size_t alignment) {
+    allocations++;
+    bytesRequested += bytes;
+    return buffer.allocate(bytes, alignment);
+}
+
+void Arena::reset() {
+    buffer.release();
+    allocations = 0;
+    bytesRequested = 0;
+    upstream.peakBytes = upstream.heldBytes;
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <memory_resource>
+#include <cstddef>
+
+// Monotonic memory resource for scratch data that lives for one solve: blocks
+// are carved out of geometrically growing chunks, deallocate is a no-op, and
+// reset() hands every chunk back at once. Counts the allocations served and
+// the peak number of bytes held from the heap.
+class Arena : public std::pmr::memory_resource {
+private:
+    class CountingUpstream : public std::pmr::memory_resource {
+    public:
+        size_t heldBytes = 0;
+        size_t peakBytes = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+
+    CountingUpstream upstream;
+    std::pmr::monotonic_buffer_resource buffer;
+    size_t allocations = 0;
+    size_t bytesRequested = 0;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    explicit Arena(size_t initialBytes = 1 << 16);
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Releases all memory and zeroes the counters.
+    void reset();
+
+    size_t getAllocationCount() const { return allocations; }
+    size_t getBytesRequested() const { return bytesRequested; }
+    size_t getHeldBytes() const { return upstream.heldBytes; }
+    size_t getPeakBytes() const { return upstream.peakBytes; }
+};
+
+#endif
\ No newline at end of file
@@ -1,7 +1,10 @@
 #ifndef MEMORY_MONITOR_HPP
 #define MEMORY_MONITOR_HPP
+#include <cstddef>
 #ifdef __linux__
 #include <sys/resource.h>
+#include <cstdio>
+#include <unistd.h>
 #elif defined(_WIN32)
 #include <windows.h>
 #include <psapi.h>
@@ -9,6 +12,8 @@
 
 class MemoryMonitor {
 public:
+    // Process-lifetime peak RSS in KB on Linux (ru_maxrss), working set in KB on Windows.
+    // It never goes down, so per-call memory comes from AllocationTracker instead.
     static size_t getCurrentMemoryUsage() {
 #ifdef __linux__
         struct rusage usage;
@@ -20,6 +25,27 @@ public:
         if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
             return pmc.WorkingSetSize / 1024; 
         }
+#endif
+        return 0;
+    }
+
+    // Current resident set in bytes, read from /proc/self/statm on Linux.
+    static size_t getResidentBytes() {
+#ifdef __linux__
+        FILE* statm = std::fopen("/proc/self/statm", "r");
+        if (statm == nullptr) return 0;
+        unsigned long long pages = 0;
+        unsigned long long resident = 0;
+        int fields = std::fscanf(statm, "%llu %llu", &pages, &resident);
+        std::fclose(statm);
+        if (fields == 2) {
+            return static_cast<size_t>(resident) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+#elif defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS pmc;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
+            return pmc.WorkingSetSize;
+        }
 #endif
         return 0;
     }
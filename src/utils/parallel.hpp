@@ -0,0 +1,36 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include "allocation_tracker.hpp"
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+// Splits [0, n) into numThreads contiguous chunks and runs fn(threadId, begin, end)
+// on each; chunk 0 runs on the calling thread.
+template <typename Func>
+void parallelFor(int numThreads, size_t n, Func&& fn) {
+    numThreads = std::max(1, numThreads);
+    size_t chunk = (n + numThreads - 1) / numThreads;
+    std::vector<std::thread> threads;
+    for (int t = 1; t < numThreads; ++t) {
+        size_t begin = std::min(n, t * chunk);
+        size_t end = std::min(n, begin + chunk);
+        threads.emplace_back([&fn, t, begin, end]() {
+            fn(t, begin, end);
+            AllocationTracker::flushThread();
+        });
+    }
+    fn(0, 0, std::min(n, chunk));
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+inline int defaultThreadCount() {
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw == 0 ? 1 : static_cast<int>(hw);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include <cstdint>
+
+constexpr uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;
+
+// SplitMix64 finalizer: a bijective mix in which every input bit affects every output bit.
+inline uint64_t mix64(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Top 53 bits as a double in [0, 1).
+inline double toUnitInterval(uint64_t bits) {
+    return static_cast<double>(bits >> 11) * 0x1.0p-53;
+}
+
+// Uniform integer in [0, bound) from 32 random bits by multiply-shift.
+inline int scaleBits32(uint64_t bits32, uint64_t bound) {
+    return static_cast<int>((bits32 * bound) >> 32);
+}
+
+// Counter-based generator: each value is a pure function of (seed, stream,
+// counter), so parallel loops draw identical numbers however the work is split
+// and independent streams never need to be advanced or stored.
+class CounterRng {
+private:
+    uint64_t key;
+
+public:
+    explicit CounterRng(uint64_t seed) : key(mix64(seed + GOLDEN_GAMMA)) {}
+
+    uint64_t bits(uint64_t stream, uint64_t counter) const {
+        return mix64(mix64(key ^ (stream * GOLDEN_GAMMA)) + (counter + 1) * GOLDEN_GAMMA);
+    }
+
+    double uniform(uint64_t stream, uint64_t counter) const {
+        return toUnitInterval(bits(stream, counter));
+    }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#include "statistics.hpp"
+#include <algorithm>
+#include <cmath>
+
+double Statistics::quantile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) return 0.0;
+    double position = q * (sorted.size() - 1);
+    size_t below = static_cast<size_t>(std::floor(position));
+    size_t above = std::min(below + 1, sorted.size() - 1);
+    return sorted[below] + (position - below) * (sorted[above] - sorted[below]);
+}
+
+double Statistics::tCritical(size_t degreesOfFreedom) {
+    static const double table[] = {
+        0.0, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+    if (degreesOfFreedom == 0) return 0.0;
+    if (degreesOfFreedom <= 30) return table[degreesOfFreedom];
+    // Between tabulated rows use the smaller df, whose quantile is larger, so the interval never narrows.
+    if (degreesOfFreedom < 40) return 2.042;
+    if (degreesOfFreedom < 60) return 2.021;
+    if (degreesOfFreedom < 120) return 2.000;
+    return 1.980;
+}
+
+SampleSummary Statistics::summarize(std::vector<double> samples) {
+    SampleSummary summary;
+    summary.count = samples.size();
+    if (samples.empty()) return summary;
+
+    std::sort(samples.begin(), samples.end());
+    summary.min = samples.front();
+    summary.max = samples.back();
+    summary.median = quantile(samples, 0.5);
+    summary.p95 = quantile(samples, 0.95);
+
+    double sum = 0.0;
+    for (double value : samples) sum += value;
+    summary.mean = sum / samples.size();
+    double squares = 0.0;
+    for (double value : samples) squares += (value - summary.mean) * (value - summary.mean);
+    summary.stddev = samples.size() > 1 ? std::sqrt(squares / (samples.size() - 1)) : 0.0;
+
+    double halfWidth = tCritical(samples.size() - 1) * summary.stddev / std::sqrt(static_cast<double>(samples.size()));
+    summary.ciLow = summary.mean - halfWidth;
+    summary.ciHigh = summary.mean + halfWidth;
+    return summary;
+}
\ No newline at end of file
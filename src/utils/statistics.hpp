@@ -0,0 +1,33 @@
+#ifndef STATISTICS_HPP
+#define STATISTICS_HPP
+
+#include <vector>
+#include <cstddef>
+
+// Order statistics and spread of repeated timings. The confidence interval is
+// the two-sided 95% Student-t interval for the mean.
+struct SampleSummary {
+    size_t count;
+    double min;
+    double max;
+    double median;
+    double p95;
+    double mean;
+    double stddev;
+    double ciLow;
+    double ciHigh;
+
+    SampleSummary()
+        : count(0), min(0.0), max(0.0), median(0.0), p95(0.0), mean(0.0), stddev(0.0), ciLow(0.0), ciHigh(0.0) {}
+};
+
+class Statistics {
+public:
+    static SampleSummary summarize(std::vector<double> samples);
+    // Linearly interpolated quantile of sorted samples, q in [0, 1].
+    static double quantile(const std::vector<double>& sorted, double q);
+    // 97.5% quantile of Student's t (two-sided 95%); untabulated df take the next lower tabulated row.
+    static double tCritical(size_t degreesOfFreedom);
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "thread_pool.hpp"
+#include "allocation_tracker.hpp"
+#include <stdexcept>
+
+ThreadPool::ThreadPool(int threads) : numThreads(std::max(1, threads)) {
+    workers.reserve(numThreads - 1);
+    for (int t = 1; t < numThreads; ++t) {
+        workers.emplace_back(&ThreadPool::workerLoop, this, t);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::runTask(int threadId) {
+    try {
+        task(threadId);
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!failure) failure = std::current_exception();
+        }
+        // Release everyone parked in barrier(); otherwise they would wait for us forever.
+        std::lock_guard<std::mutex> lock(barrierMutex);
+        barrierAborted = true;
+        barrierWake.notify_all();
+    }
+    // Publish this participant's heap counters before run() can return, so
+    // WorkStealingScheduler jobs and pooled algorithm phases are measured too.
+    AllocationTracker::flushThread();
+}
+
+void ThreadPool::workerLoop(int threadId) {
+    size_t seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&]() { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+        }
+        runTask(threadId);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--pending == 0) finished.notify_one();
+        }
+    }
+}
+
+void ThreadPool::run(const std::function<void(int)>& job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = job;
+        failure = nullptr;
+        std::lock_guard<std::mutex> barrierLock(barrierMutex);
+        barrierWaiting = 0;
+        barrierAborted = false;
+        pending = numThreads - 1;
+        generation++;
+    }
+    wake.notify_all();
+    runTask(0);
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&]() { return pending == 0; });
+        task = nullptr;
+        error = failure;
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+void ThreadPool::barrier() {
+    if (numThreads == 1) return;
+    std::unique_lock<std::mutex> lock(barrierMutex);
+    if (barrierAborted) throw std::runtime_error("ThreadPool barrier aborted: another participant failed");
+    size_t arrival = barrierGeneration;
+    if (++barrierWaiting == numThreads) {
+        barrierWaiting = 0;
+        barrierGeneration++;
+        barrierWake.notify_all();
+        return;
+    }
+    barrierWake.wait(lock, [&]() { return barrierGeneration != arrival || barrierAborted; });
+    if (barrierGeneration == arrival) {
+        throw std::runtime_error("ThreadPool barrier aborted: another participant failed");
+    }
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+#include <memory>
+#include <algorithm>
+#include <cstddef>
+
+// Fixed set of workers that stay parked between jobs. run(task) executes
+// task(threadId) once on every participant (the caller is participant 0) and
+// returns when all of them are done; inside a task, barrier() separates phases
+// without leaving the pool. If a participant throws, barriers of that run stop
+// waiting and throw on the other participants too, and run() rethrows the
+// first exception. A pool may be shared between algorithms through a
+// shared_ptr, but only one run() may be in flight at a time.
+class ThreadPool {
+private:
+    int numThreads;
+    std::vector<std::thread> workers;
+    std::function<void(int)> task;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable finished;
+    size_t generation = 0;
+    int pending = 0;
+    bool stopping = false;
+    std::exception_ptr failure;
+
+    std::mutex barrierMutex;
+    std::condition_variable barrierWake;
+    int barrierWaiting = 0;
+    size_t barrierGeneration = 0;
+    bool barrierAborted = false;
+
+    void workerLoop(int threadId);
+    void runTask(int threadId);
+
+public:
+    explicit ThreadPool(int threads);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    int size() const { return numThreads; }
+    void run(const std::function<void(int)>& job);
+    // Blocks until every participant of the current run() has reached it;
+    // throws std::runtime_error once another participant has failed.
+    void barrier();
+
+    // Same chunking as ::parallelFor, so results match it for equal thread counts.
+    template <typename Func>
+    void parallelFor(size_t n, Func&& fn) {
+        size_t chunk = (n + numThreads - 1) / numThreads;
+        run([&](int t) {
+            size_t begin = std::min(n, t * chunk);
+            size_t end = std::min(n, begin + chunk);
+            fn(t, begin, end);
+        });
+    }
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "work_stealing.hpp"
+
+void WorkStealingScheduler::distribute(size_t n) {
+    int threads = size();
+    grain = std::max(minGrain, n / (static_cast<size_t>(threads) * 64));
+    size_t chunk = (n + threads - 1) / threads;
+    for (int t = 0; t < threads; ++t) {
+        size_t begin = std::min(n, t * chunk);
+        size_t end = std::min(n, begin + chunk);
+        std::lock_guard<std::mutex> lock(workers[t].mutex);
+        workers[t].ranges.clear();
+        if (begin < end) workers[t].ranges.push_back({begin, end});
+    }
+    aborted.store(false, std::memory_order_relaxed);
+    remaining.store(n, std::memory_order_release);
+}
+
+bool WorkStealingScheduler::popLocal(int tid, Range& range) {
+    Worker& self = workers[tid];
+    std::lock_guard<std::mutex> lock(self.mutex);
+    if (self.ranges.empty()) return false;
+    range = self.ranges.back();
+    self.ranges.pop_back();
+    return true;
+}
+
+bool WorkStealingScheduler::steal(int tid, Range& range) {
+    int threads = size();
+    for (int offset = 1; offset < threads; ++offset) {
+        Worker& victim = workers[(tid + offset) % threads];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.ranges.empty()) continue;
+        range = victim.ranges.front();
+        victim.ranges.pop_front();
+        workers[tid].stats.steals++;
+        return true;
+    }
+    return false;
+}
+
+bool WorkStealingScheduler::exposeHalf(int tid, Range& range) {
+    if (size() == 1 || range.end - range.begin < 2 * grain) return false;
+    Worker& self = workers[tid];
+    std::lock_guard<std::mutex> lock(self.mutex);
+    if (!self.ranges.empty()) return false;
+    size_t mid = range.begin + (range.end - range.begin) / 2;
+    self.ranges.push_back({mid, range.end});
+    range.end = mid;
+    return true;
+}
+
+void WorkStealingScheduler::resetStats() {
+    for (auto& worker : workers) {
+        worker.stats = WorkerStats();
+    }
+}
+
+std::map<std::string, double> WorkStealingScheduler::statsSummary() const {
+    std::map<std::string, double> summary;
+    double maxBusy = 0.0;
+    double totalBusy = 0.0;
+    double steals = 0.0;
+    for (int t = 0; t < size(); ++t) {
+        const WorkerStats& stats = workers[t].stats;
+        summary["worker_" + std::to_string(t) + "_busy_ms"] = stats.busyMilliseconds;
+        summary["worker_" + std::to_string(t) + "_idle_ms"] = stats.idleMilliseconds;
+        maxBusy = std::max(maxBusy, stats.busyMilliseconds);
+        totalBusy += stats.busyMilliseconds;
+        steals += static_cast<double>(stats.steals);
+    }
+    summary["steals"] = steals;
+    summary["busy_imbalance"] = totalBusy > 0.0 ? maxBusy * size() / totalBusy : 1.0;
+    return summary;
+}
\ No newline at end of file
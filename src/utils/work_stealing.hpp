@@ -0,0 +1,128 @@
+#ifndef WORK_STEALING_HPP
+#define WORK_STEALING_HPP
+
+#include "thread_pool.hpp"
+#include <vector>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+#include <algorithm>
+#include <cstddef>
+
+// Range scheduler on top of a ThreadPool. Every worker starts with one
+// contiguous slice of [0, n) in its own deque and eats it grain by grain from
+// the front; whenever its deque is empty it first splits the rest of its range
+// in half and exposes the upper half (lazy binary splitting). Idle workers steal
+// the oldest, largest range from the front of another worker's deque.
+class WorkStealingScheduler {
+public:
+    struct WorkerStats {
+        double busyMilliseconds = 0.0;
+        double idleMilliseconds = 0.0;
+        size_t chunks = 0;
+        size_t steals = 0;
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Range {
+        size_t begin;
+        size_t end;
+    };
+
+    struct alignas(64) Worker {
+        std::mutex mutex;
+        std::deque<Range> ranges;
+        WorkerStats stats;
+    };
+
+    ThreadPool& pool;
+    size_t minGrain;
+    std::vector<Worker> workers;
+    std::atomic<size_t> remaining{0};
+    // Set when fn throws: the failed piece is never subtracted from remaining,
+    // so the other workers stop on this flag instead and skip what is left.
+    std::atomic<bool> aborted{false};
+    size_t grain = 1;
+
+    static double millisecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    void distribute(size_t n);
+    bool popLocal(int tid, Range& range);
+    bool steal(int tid, Range& range);
+    bool exposeHalf(int tid, Range& range);
+
+    template <typename Func>
+    void work(int tid, Func& fn) {
+        Worker& self = workers[tid];
+        Clock::time_point start = Clock::now();
+        double busy = 0.0;
+        Range range;
+        while (true) {
+            if (!popLocal(tid, range) && !steal(tid, range)) {
+                if (remaining.load(std::memory_order_acquire) == 0 || aborted.load(std::memory_order_acquire)) break;
+                std::this_thread::yield();
+                continue;
+            }
+            while (range.begin < range.end && !aborted.load(std::memory_order_relaxed)) {
+                exposeHalf(tid, range);
+                size_t end = std::min(range.end, range.begin + grain);
+                Clock::time_point pieceStart = Clock::now();
+                try {
+                    fn(tid, range.begin, end);
+                } catch (...) {
+                    aborted.store(true, std::memory_order_release);
+                    throw;
+                }
+                busy += millisecondsSince(pieceStart);
+                self.stats.chunks++;
+                remaining.fetch_sub(end - range.begin, std::memory_order_acq_rel);
+                range.begin = end;
+            }
+        }
+        self.stats.busyMilliseconds += busy;
+        self.stats.idleMilliseconds += millisecondsSince(start) - busy;
+    }
+
+public:
+    explicit WorkStealingScheduler(ThreadPool& threadPool, size_t minimumGrain = 1024)
+        : pool(threadPool), minGrain(std::max<size_t>(1, minimumGrain)), workers(threadPool.size()) {}
+
+    int size() const { return pool.size(); }
+
+    // Runs fn(workerId, begin, end) over disjoint pieces covering [0, n). If
+    // fn throws, the remaining pieces are skipped and pool.run() rethrows.
+    template <typename Func>
+    void parallelFor(size_t n, Func&& fn) {
+        if (n == 0) return;
+        distribute(n);
+        pool.run([&](int tid) { work(tid, fn); });
+    }
+
+    // Same, called by every participant from inside pool.run(); returns on
+    // each thread once the whole range is done. A throw in fn surfaces from
+    // the enclosing pool.run(); the other participants leave through barrier().
+    template <typename Func>
+    void collectiveFor(int tid, size_t n, Func&& fn) {
+        if (n == 0) return;
+        if (tid == 0) distribute(n);
+        pool.barrier();
+        work(tid, fn);
+        pool.barrier();
+    }
+
+    const WorkerStats& getStats(int tid) const { return workers[tid].stats; }
+    void resetStats();
+    // worker_N_busy_ms / worker_N_idle_ms per worker, total steals, and busy
+    // imbalance (max busy over mean busy, 1.0 when perfectly balanced).
+    std::map<std::string, double> statsSummary() const;
+};
+
+#endif
\ No newline at end of file